@@ -49,11 +49,22 @@ namespace Anubis
 {
     std::unique_ptr<Anubis> gAnubisApi;
 
-    Anubis::Anubis(std::unique_ptr<Config> &&config) : m_config(std::move(config))
+    Anubis::Anubis(std::unique_ptr<Config> &&config)
+        : m_config(std::move(config)),
+          m_timers(std::make_unique<Timers>()),
+          m_chatFilter(std::make_unique<ChatFilter>()),
+          m_connectLimiter(std::make_unique<ConnectLimiter>(m_config->getConnectLimits())),
+          m_banIndex(std::make_unique<BanIndex>(m_config->getPath(PathType::Configs) / "bans.dat")),
+          m_precacheManager(std::make_unique<PrecacheManager>(m_config->getPrecacheSettings(),
+                                                              m_config->getPath(PathType::Configs) / "precache",
+                                                              m_logger)),
+          m_soundCuller(std::make_unique<SoundCuller>(m_config->getSoundSettings()))
     {
         _initEngineMessages();
     }
 
+    Anubis::~Anubis() = default;
+
     nstd::observer_ptr<Engine::ILibrary> Anubis::getEngine(InterfaceVersion version) const
     {
         return isInterfaceCompatible(version, Engine::ILibrary::VERSION) ? getEngine() : nullptr;
@@ -97,6 +108,50 @@ namespace Anubis
         return m_regMsgs.front();
     }
 
+    nstd::observer_ptr<ITimers> Anubis::getTimers(InterfaceVersion version) const
+    {
+        return isInterfaceCompatible(version, ITimers::VERSION) ? nstd::observer_ptr<ITimers>(m_timers) : nullptr;
+    }
+
+    nstd::observer_ptr<IPlayerStorage> Anubis::getPlayerStorage(InterfaceVersion version) const
+    {
+        return isInterfaceCompatible(version, IPlayerStorage::VERSION)
+                   ? nstd::observer_ptr<IPlayerStorage>(m_playerStorage)
+                   : nullptr;
+    }
+
+    nstd::observer_ptr<IBanIndex> Anubis::getBanIndex(InterfaceVersion version) const
+    {
+        return isInterfaceCompatible(version, IBanIndex::VERSION) ? nstd::observer_ptr<IBanIndex>(m_banIndex)
+                                                                  : nullptr;
+    }
+
+    nstd::observer_ptr<ICvarQueries> Anubis::getCvarQueries(InterfaceVersion version) const
+    {
+        return isInterfaceCompatible(version, ICvarQueries::VERSION) ? nstd::observer_ptr<ICvarQueries>(m_cvarQueries)
+                                                                     : nullptr;
+    }
+
+    nstd::observer_ptr<IEntityWatcher> Anubis::getEntityWatcher(InterfaceVersion version) const
+    {
+        return isInterfaceCompatible(version, IEntityWatcher::VERSION)
+                   ? nstd::observer_ptr<IEntityWatcher>(m_entityWatcher)
+                   : nullptr;
+    }
+
+    nstd::observer_ptr<IPlayerHistory> Anubis::getPlayerHistory(InterfaceVersion version) const
+    {
+        return isInterfaceCompatible(version, IPlayerHistory::VERSION)
+                   ? nstd::observer_ptr<IPlayerHistory>(m_playerHistory)
+                   : nullptr;
+    }
+
+    nstd::observer_ptr<IEntityPools> Anubis::getEntityPools(InterfaceVersion version) const
+    {
+        return isInterfaceCompatible(version, IEntityPools::VERSION) ? nstd::observer_ptr<IEntityPools>(m_entityPools)
+                                                                     : nullptr;
+    }
+
     bool Anubis::addNewMsg(Engine::MsgType msgType, std::string_view name, Engine::MsgSize size)
     {
         if (_findMessage(msgType))
@@ -280,6 +335,12 @@ namespace Anubis
     void Anubis::initEngine(std::unique_ptr<enginefuncs_t> &&engineFuncs, nstd::observer_ptr<globalvars_t> globals)
     {
         m_engineLib = std::make_unique<Engine::Library>(std::move(engineFuncs), globals);
+        m_playerStorage = std::make_unique<PlayerStorage>(m_engineLib->getMaxClientsLimit());
+        m_cmdLimiter = std::make_unique<CmdLimiter>(m_config->getCmdLimitClasses(), m_engineLib->getMaxClientsLimit());
+        m_cvarQueries = std::make_unique<CvarQueries>(m_engineLib, m_engineLib->getMaxClientsLimit());
+        m_playerHistory = std::make_unique<PlayerHistory>(m_engineLib, m_engineLib->getMaxClientsLimit());
+        m_entityPools = std::make_unique<EntityPools>(m_engineLib);
+        m_entityWatcher = std::make_unique<EntityWatcher>(m_engineLib);
     }
 
     void Anubis::initLogger()
@@ -308,6 +369,100 @@ namespace Anubis
         return m_logger;
     }
 
+    const std::unique_ptr<Timers> &Anubis::getTimers() const
+    {
+        return m_timers;
+    }
+
+    const std::unique_ptr<PlayerStorage> &Anubis::getPlayerStorage() const
+    {
+        return m_playerStorage;
+    }
+
+    const std::unique_ptr<ChatFilter> &Anubis::getChatFilter() const
+    {
+        return m_chatFilter;
+    }
+
+    const std::unique_ptr<CmdLimiter> &Anubis::getCmdLimiter() const
+    {
+        return m_cmdLimiter;
+    }
+
+    const std::unique_ptr<ConnectLimiter> &Anubis::getConnectLimiter() const
+    {
+        return m_connectLimiter;
+    }
+
+    const std::unique_ptr<BanIndex> &Anubis::getBanIndex() const
+    {
+        return m_banIndex;
+    }
+
+    const std::unique_ptr<CvarQueries> &Anubis::getCvarQueries() const
+    {
+        return m_cvarQueries;
+    }
+
+    const std::unique_ptr<PlayerHistory> &Anubis::getPlayerHistory() const
+    {
+        return m_playerHistory;
+    }
+
+    const std::unique_ptr<EntityPools> &Anubis::getEntityPools() const
+    {
+        return m_entityPools;
+    }
+
+    const std::unique_ptr<EntityWatcher> &Anubis::getEntityWatcher() const
+    {
+        return m_entityWatcher;
+    }
+
+    const std::unique_ptr<PrecacheManager> &Anubis::getPrecacheManager() const
+    {
+        return m_precacheManager;
+    }
+
+    const std::unique_ptr<SoundCuller> &Anubis::getSoundCuller() const
+    {
+        return m_soundCuller;
+    }
+
+    void Anubis::loadBanIndex()
+    {
+        try
+        {
+            m_banIndex->load();
+        }
+        catch (const std::exception &e)
+        {
+            m_logger->logMsg(LogDest::ConsoleFile, LogLevel::Error, e.what());
+            return;
+        }
+
+        m_logger->logMsg(LogLevel::Info, LogDest::ConsoleFile, "Ban index has loaded {} address(es) and {} auth ID(s)",
+                         m_banIndex->getAddressesNum(), m_banIndex->getAuthIDsNum());
+    }
+
+    void Anubis::loadChatFilter()
+    {
+        std::filesystem::path chatFilterFilePath(m_config->getPath(PathType::Configs) / "chatfilter.yaml");
+
+        try
+        {
+            m_chatFilter->load(chatFilterFilePath);
+        }
+        catch (const std::runtime_error &e)
+        {
+            m_logger->logMsg(LogDest::ConsoleFile, LogLevel::Error, e.what());
+            return;
+        }
+
+        m_logger->logMsg(LogLevel::Info, LogDest::ConsoleFile, "Chat filter has loaded {} pattern(s)",
+                         m_chatFilter->getPatterns().size());
+    }
+
     void Anubis::printInfo() const
     {
         static auto general = fmt::format("{} v{}  {} {}\n", ANUBIS_NAME, ANUBIS_VERSION, __DATE__, __TIME__);
@@ -351,4 +506,78 @@ namespace Anubis
             m_engineLib->print(pluginsCountMsg, FuncCallType::Direct);
         }
     }
+
+    void Anubis::printChatFilterStats() const
+    {
+        static constexpr std::array<std::string_view, 4> actionNames = {"none", "flag", "replace", "block"};
+
+        m_engineLib->print("Chat filter patterns:\n", FuncCallType::Direct);
+
+        std::size_t i = 0;
+        for (const auto &pattern : m_chatFilter->getPatterns())
+        {
+            m_engineLib->print(fmt::format("  [{}] \"{}\" Action: {} Hits: {}\n", i++, pattern.text,
+                                           actionNames[static_cast<std::size_t>(pattern.action)], pattern.hits),
+                               FuncCallType::Direct);
+        }
+
+        if (!i)
+        {
+            m_engineLib->print("No patterns loaded\n", FuncCallType::Direct);
+        }
+    }
+
+    void Anubis::printStats() const
+    {
+        const auto &cmdClasses = m_cmdLimiter->getClasses();
+        const auto &cmdStats = m_cmdLimiter->getStats();
+
+        m_engineLib->print("Client command limits:\n", FuncCallType::Direct);
+
+        for (std::size_t i = 0; i < cmdClasses.size(); i++)
+        {
+            m_engineLib->print(fmt::format("  [{}] Allowed: {} Dropped: {} Delayed: {} Kicked: {}\n",
+                                           cmdClasses[i].name, cmdStats[i].allowed, cmdStats[i].dropped,
+                                           cmdStats[i].delayed, cmdStats[i].kicked),
+                               FuncCallType::Direct);
+        }
+
+        if (cmdClasses.empty())
+        {
+            m_engineLib->print("No limits configured\n", FuncCallType::Direct);
+        }
+
+        auto connectStats = m_connectLimiter->getStats(m_engineLib->getTime());
+        m_engineLib->print(fmt::format("Connection attempts: {} Rejected: {} Tracked sources: {}\n",
+                                       connectStats.attempts, connectStats.rejected, connectStats.sourcesNum),
+                           FuncCallType::Direct);
+        m_engineLib->print(fmt::format("  Last {}s: {:.2f} attempts/s {:.2f} rejected/s\n", ConnectLimiter::RATE_WINDOW,
+                                       connectStats.attemptsRate, connectStats.rejectedRate),
+                           FuncCallType::Direct);
+        m_engineLib->print(fmt::format("Precache slots used: {}/{} models {}/{} sounds {}/{} generic\n",
+                                       m_precacheManager->getUsedNum(PrecacheType::Model), PrecacheManager::MAX_ENTRIES,
+                                       m_precacheManager->getUsedNum(PrecacheType::Sound), PrecacheManager::MAX_ENTRIES,
+                                       m_precacheManager->getUsedNum(PrecacheType::Generic),
+                                       PrecacheManager::MAX_ENTRIES),
+                           FuncCallType::Direct);
+
+        if (m_soundCuller->isEnabled())
+        {
+            const auto &soundStats = m_soundCuller->getStats();
+            m_engineLib->print(fmt::format("Sounds passed: {} Duplicates dropped: {} Inaudible dropped: {}\n",
+                                           soundStats.passed, soundStats.duplicates, soundStats.inaudible),
+                               FuncCallType::Direct);
+        }
+        else
+        {
+            m_engineLib->print("Sound culling disabled\n", FuncCallType::Direct);
+        }
+    }
+
+    void Anubis::printBanIndexInfo() const
+    {
+        m_engineLib->print(fmt::format("Banned addresses: {} Banned auth IDs: {}\n", m_banIndex->getAddressesNum(),
+                                       m_banIndex->getAuthIDsNum()),
+                           FuncCallType::Direct);
+    }
 } // namespace Anubis
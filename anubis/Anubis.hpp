@@ -26,6 +26,18 @@
 #include "Module.hpp"
 #include "Msg.hpp"
 #include "Logger.hpp"
+#include "Timers.hpp"
+#include "PlayerStorage.hpp"
+#include "ChatFilter.hpp"
+#include "CmdLimiter.hpp"
+#include "ConnectLimiter.hpp"
+#include "BanIndex.hpp"
+#include "CvarQueries.hpp"
+#include "PlayerHistory.hpp"
+#include "EntityPools.hpp"
+#include "EntityWatcher.hpp"
+#include "PrecacheManager.hpp"
+#include "SoundCuller.hpp"
 
 #include <fmt/format.h>
 
@@ -34,6 +46,11 @@
 
 typedef struct globalvars_s globalvars_t;
 
+namespace Anubis::Engine
+{
+    class Library;
+}
+
 namespace Anubis
 {
     class Anubis final : public IAnubis
@@ -43,13 +60,20 @@ namespace Anubis
 
     public:
         explicit Anubis(std::unique_ptr<Config> &&config);
-        ~Anubis() final = default;
+        ~Anubis() final;
 
         [[nodiscard]] nstd::observer_ptr<Engine::ILibrary> getEngine(InterfaceVersion version) const final;
         [[nodiscard]] nstd::observer_ptr<Game::ILibrary> getGame(InterfaceVersion version) const final;
         [[nodiscard]] std::unique_ptr<ILogger> getLogger(InterfaceVersion version) const final;
         [[nodiscard]] nstd::observer_ptr<IMsg> getMsgInfo(std::string_view name) const final;
         [[nodiscard]] nstd::observer_ptr<IMsg> getMsgInfo(Engine::MsgType msgType) const final;
+        [[nodiscard]] nstd::observer_ptr<ITimers> getTimers(InterfaceVersion version) const final;
+        [[nodiscard]] nstd::observer_ptr<IPlayerStorage> getPlayerStorage(InterfaceVersion version) const final;
+        [[nodiscard]] nstd::observer_ptr<IBanIndex> getBanIndex(InterfaceVersion version) const final;
+        [[nodiscard]] nstd::observer_ptr<ICvarQueries> getCvarQueries(InterfaceVersion version) const final;
+        [[nodiscard]] nstd::observer_ptr<IPlayerHistory> getPlayerHistory(InterfaceVersion version) const final;
+        [[nodiscard]] nstd::observer_ptr<IEntityPools> getEntityPools(InterfaceVersion version) const final;
+        [[nodiscard]] nstd::observer_ptr<IEntityWatcher> getEntityWatcher(InterfaceVersion version) const final;
 
         [[nodiscard]] nstd::observer_ptr<Engine::ILibrary> getEngine() const;
         [[nodiscard]] nstd::observer_ptr<Game::ILibrary> getGame() const;
@@ -66,8 +90,25 @@ namespace Anubis
         void initGameDLL();
         void installVFHooksForPlugins() const;
         [[nodiscard]] const std::unique_ptr<Logger> &getLogger() const;
+        [[nodiscard]] const std::unique_ptr<Timers> &getTimers() const;
+        [[nodiscard]] const std::unique_ptr<PlayerStorage> &getPlayerStorage() const;
+        [[nodiscard]] const std::unique_ptr<ChatFilter> &getChatFilter() const;
+        [[nodiscard]] const std::unique_ptr<CmdLimiter> &getCmdLimiter() const;
+        [[nodiscard]] const std::unique_ptr<ConnectLimiter> &getConnectLimiter() const;
+        [[nodiscard]] const std::unique_ptr<BanIndex> &getBanIndex() const;
+        [[nodiscard]] const std::unique_ptr<CvarQueries> &getCvarQueries() const;
+        [[nodiscard]] const std::unique_ptr<PlayerHistory> &getPlayerHistory() const;
+        [[nodiscard]] const std::unique_ptr<EntityPools> &getEntityPools() const;
+        [[nodiscard]] const std::unique_ptr<EntityWatcher> &getEntityWatcher() const;
+        [[nodiscard]] const std::unique_ptr<PrecacheManager> &getPrecacheManager() const;
+        [[nodiscard]] const std::unique_ptr<SoundCuller> &getSoundCuller() const;
+        void loadBanIndex();
+        void loadChatFilter();
         void printInfo() const;
         void printPluginList() const;
+        void printChatFilterStats() const;
+        void printStats() const;
+        void printBanIndexInfo() const;
 
     private:
         void _initEngineMessages();
@@ -75,11 +116,23 @@ namespace Anubis
 
     private:
         std::unique_ptr<Config> m_config;
-        std::unique_ptr<Engine::ILibrary> m_engineLib;
+        std::unique_ptr<Engine::Library> m_engineLib;
         std::unique_ptr<Logger> m_logger;
         std::unique_ptr<Game::ILibrary> m_gameLib;
         std::vector<std::unique_ptr<Module>> m_plugins;
         std::array<std::unique_ptr<IMsg>, 256> m_regMsgs;
+        std::unique_ptr<Timers> m_timers;
+        std::unique_ptr<PlayerStorage> m_playerStorage;
+        std::unique_ptr<ChatFilter> m_chatFilter;
+        std::unique_ptr<CmdLimiter> m_cmdLimiter;
+        std::unique_ptr<ConnectLimiter> m_connectLimiter;
+        std::unique_ptr<BanIndex> m_banIndex;
+        std::unique_ptr<CvarQueries> m_cvarQueries;
+        std::unique_ptr<PlayerHistory> m_playerHistory;
+        std::unique_ptr<EntityPools> m_entityPools;
+        std::unique_ptr<EntityWatcher> m_entityWatcher;
+        std::unique_ptr<PrecacheManager> m_precacheManager;
+        std::unique_ptr<SoundCuller> m_soundCuller;
     };
     extern std::unique_ptr<Anubis> gAnubisApi;
 } // namespace Anubis
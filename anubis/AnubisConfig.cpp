@@ -100,6 +100,26 @@ namespace Anubis
         return m_initialLogLevel;
     }
 
+    const std::vector<CmdLimitClass> &Config::getCmdLimitClasses() const
+    {
+        return m_cmdLimitClasses;
+    }
+
+    const ConnectLimits &Config::getConnectLimits() const
+    {
+        return m_connectLimits;
+    }
+
+    const PrecacheSettings &Config::getPrecacheSettings() const
+    {
+        return m_precacheSettings;
+    }
+
+    const SoundSettings &Config::getSoundSettings() const
+    {
+        return m_soundSettings;
+    }
+
     std::filesystem::path Config::_getAnubisPath() const
     {
         constexpr const char *liblistEntry = "gamedll"
@@ -212,6 +232,88 @@ namespace Anubis
 
                 m_initialLogLevel = std::move(level);
             }
+            else if (nodeName == "cmdlimits")
+            {
+                _readCmdLimits(it->second);
+            }
+            else if (nodeName == "connectlimits")
+            {
+                _readConnectLimits(it->second);
+            }
+            else if (nodeName == "precache")
+            {
+                _readPrecacheSettings(it->second);
+            }
+            else if (nodeName == "sounds")
+            {
+                _readSoundSettings(it->second);
+            }
         }
     }
+
+    void Config::_readCmdLimits(const YAML::Node &node)
+    {
+        using namespace std::string_literals;
+
+        for (const auto &classNode : node)
+        {
+            CmdLimitClass cmdClass;
+            cmdClass.name = classNode["name"].as<std::string>();
+            cmdClass.rate = classNode["rate"].as<float>();
+            cmdClass.burst = std::max(classNode["burst"].as<float>(cmdClass.rate), 1.0f);
+
+            if (const auto &commandsNode = classNode["commands"]; commandsNode)
+            {
+                for (const auto &command : commandsNode)
+                {
+                    cmdClass.commands.push_back(Utils::toLowerCopy(command.as<std::string>()));
+                }
+            }
+
+            auto action = Utils::toLowerCopy(classNode["action"].as<std::string>("drop"));
+            if (action == "drop")
+            {
+                cmdClass.action = CmdLimitAction::Drop;
+            }
+            else if (action == "delay")
+            {
+                cmdClass.action = CmdLimitAction::Delay;
+            }
+            else if (action == "kick")
+            {
+                cmdClass.action = CmdLimitAction::Kick;
+            }
+            else
+            {
+                throw std::runtime_error("Unknown action \""s + action + "\" of command limit " + cmdClass.name);
+            }
+
+            m_cmdLimitClasses.push_back(std::move(cmdClass));
+        }
+    }
+
+    void Config::_readConnectLimits(const YAML::Node &node)
+    {
+        m_connectLimits.rate = std::max(node["rate"].as<float>(), 0.0f);
+        m_connectLimits.burst = std::max(node["burst"].as<float>(m_connectLimits.rate), 1.0f);
+        m_connectLimits.prefixLen = static_cast<std::uint8_t>(std::clamp(node["prefix"].as<int>(32), 0, 32));
+        m_connectLimits.sourcesNum =
+            std::max(node["sources"].as<std::size_t>(m_connectLimits.sourcesNum), static_cast<std::size_t>(1));
+
+        if (const auto &reasonNode = node["reason"]; reasonNode)
+        {
+            m_connectLimits.reason = reasonNode.as<std::string>();
+        }
+    }
+
+    void Config::_readPrecacheSettings(const YAML::Node &node)
+    {
+        m_precacheSettings.warnFree = node["warn"].as<std::size_t>(m_precacheSettings.warnFree);
+        m_precacheSettings.manifest = node["manifest"].as<bool>(m_precacheSettings.manifest);
+    }
+
+    void Config::_readSoundSettings(const YAML::Node &node)
+    {
+        m_soundSettings.cull = node["cull"].as<bool>(m_soundSettings.cull);
+    }
 } // namespace Anubis
@@ -23,9 +23,56 @@
 
 #include <filesystem>
 #include <array>
+#include <string>
+#include <vector>
+
+namespace YAML
+{
+    class Node;
+}
 
 namespace Anubis
 {
+    enum class CmdLimitAction : std::uint8_t
+    {
+        Drop = 0,
+        Delay,
+        Kick
+    };
+
+    /* Token bucket limits of the group of client commands */
+    struct CmdLimitClass
+    {
+        std::string name;
+        std::vector<std::string> commands; // empty for the class of all other commands
+        float rate;                        // tokens per second
+        float burst;                       // bucket capacity
+        CmdLimitAction action;
+    };
+
+    /* Token bucket limits of connection attempts per source address */
+    struct ConnectLimits
+    {
+        float rate = 0.0f;           // attempts per second, 0 disables the limiter
+        float burst = 1.0f;          // bucket capacity
+        std::uint8_t prefixLen = 32; // sources are grouped by IPv4 prefix of this length
+        std::size_t sourcesNum = 4096;
+        std::string reason = "Too many connection attempts";
+    };
+
+    /* Tracking of precache slots and the per-map manifest */
+    struct PrecacheSettings
+    {
+        std::size_t warnFree = 32; // warn once per map when fewer slots are free
+        bool manifest = false;     // write precached resources on map change and precache them on the next load
+    };
+
+    /* Culling of emitted sounds */
+    struct SoundSettings
+    {
+        bool cull = false; // drop repeated sounds within a frame and sounds no client can hear
+    };
+
     class Config
     {
     public:
@@ -37,15 +84,27 @@ namespace Anubis
         void setLogLevel(LogLevel level);
         bool setLogLevel(std::string_view level);
         std::string_view getInitLogLevel() const;
+        [[nodiscard]] const std::vector<CmdLimitClass> &getCmdLimitClasses() const;
+        [[nodiscard]] const ConnectLimits &getConnectLimits() const;
+        [[nodiscard]] const PrecacheSettings &getPrecacheSettings() const;
+        [[nodiscard]] const SoundSettings &getSoundSettings() const;
 
     private:
         [[nodiscard]] std::filesystem::path _getAnubisPath() const;
         void _readConfigFile();
+        void _readCmdLimits(const YAML::Node &node);
+        void _readConnectLimits(const YAML::Node &node);
+        void _readPrecacheSettings(const YAML::Node &node);
+        void _readSoundSettings(const YAML::Node &node);
 
     private:
         std::array<std::filesystem::path, 5> m_paths;
         LogLevel m_currentLogLevel {LogLevel::Info};
         std::string m_configFilename = "config.yaml";
         std::string m_initialLogLevel;
+        std::vector<CmdLimitClass> m_cmdLimitClasses;
+        ConnectLimits m_connectLimits;
+        PrecacheSettings m_precacheSettings;
+        SoundSettings m_soundSettings;
     };
 } // namespace Anubis
\ No newline at end of file
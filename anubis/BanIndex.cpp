@@ -0,0 +1,589 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "BanIndex.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+#if defined __linux__
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#elif defined _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+    #include <intrin.h>
+#endif
+
+namespace Anubis
+{
+    namespace
+    {
+        /* Read-only view of the whole file */
+        class MappedFile
+        {
+        public:
+            explicit MappedFile(const std::filesystem::path &path)
+            {
+#if defined __linux__
+                int fd = open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                {
+                    return;
+                }
+
+                struct stat fileStat {};
+                if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+                {
+                    void *data = mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (data != MAP_FAILED)
+                    {
+                        m_data = static_cast<const std::uint8_t *>(data);
+                        m_size = static_cast<std::size_t>(fileStat.st_size);
+                    }
+                }
+                close(fd);
+#elif defined _WIN32
+                HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return;
+                }
+
+                LARGE_INTEGER fileSize;
+                if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+                {
+                    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    if (mapping)
+                    {
+                        if (void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0); data)
+                        {
+                            m_data = static_cast<const std::uint8_t *>(data);
+                            m_size = static_cast<std::size_t>(fileSize.QuadPart);
+                        }
+                        CloseHandle(mapping);
+                    }
+                }
+                CloseHandle(file);
+#endif
+            }
+
+            ~MappedFile()
+            {
+                if (!m_data)
+                {
+                    return;
+                }
+
+#if defined __linux__
+                munmap(const_cast<std::uint8_t *>(m_data), m_size);
+#elif defined _WIN32
+                UnmapViewOfFile(m_data);
+#endif
+            }
+
+            MappedFile(const MappedFile &) = delete;
+            MappedFile &operator=(const MappedFile &) = delete;
+
+            [[nodiscard]] const std::uint8_t *data() const
+            {
+                return m_data;
+            }
+
+            [[nodiscard]] std::size_t size() const
+            {
+                return m_size;
+            }
+
+        private:
+            const std::uint8_t *m_data = nullptr;
+            std::size_t m_size = 0;
+        };
+
+        template<typename t_int>
+        void writeLittleEndian(std::ofstream &file, t_int value)
+        {
+            std::array<char, sizeof(t_int)> bytes;
+            for (std::size_t i = 0; i < bytes.size(); i++)
+            {
+                bytes[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+            }
+
+            file.write(bytes.data(), bytes.size());
+        }
+
+        template<typename t_int>
+        t_int readLittleEndian(const std::uint8_t *data)
+        {
+            t_int value = 0;
+            for (std::size_t i = 0; i < sizeof(t_int); i++)
+            {
+                value = static_cast<t_int>(value | static_cast<t_int>(data[i]) << (i * 8));
+            }
+
+            return value;
+        }
+
+        constexpr std::uint32_t prefixMask(std::uint8_t len)
+        {
+            return len ? 0xFFFFFFFFu << (32 - len) : 0u;
+        }
+
+        constexpr std::uint32_t bitAt(std::uint32_t ip, std::uint8_t pos)
+        {
+            return (ip >> (31 - pos)) & 1u;
+        }
+
+        std::uint8_t commonPrefixLen(std::uint32_t a, std::uint32_t b, std::uint8_t maxLen)
+        {
+            std::uint32_t diff = a ^ b;
+            if (!diff)
+            {
+                return maxLen;
+            }
+
+#if defined _MSC_VER
+            unsigned long index;
+            _BitScanReverse(&index, diff);
+            auto len = static_cast<std::uint8_t>(31 - index);
+#else
+            auto len = static_cast<std::uint8_t>(__builtin_clz(diff));
+#endif
+            return std::min(len, maxLen);
+        }
+    } // namespace
+
+    BanIndex::BanIndex(std::filesystem::path path) : m_path(std::move(path)) {}
+
+    bool BanIndex::addAddress(std::string_view cidr)
+    {
+        std::uint32_t ip;
+        std::uint8_t len;
+
+        return _parseCidr(cidr, ip, len) && _insert(ip, len);
+    }
+
+    bool BanIndex::removeAddress(std::string_view cidr)
+    {
+        std::uint32_t ip;
+        std::uint8_t len;
+
+        return _parseCidr(cidr, ip, len) && _erase(ip, len);
+    }
+
+    bool BanIndex::isAddressBanned(std::string_view address) const
+    {
+        std::uint32_t ip;
+        if (!m_addressesNum || !Utils::parseIPv4(address, ip))
+        {
+            return false;
+        }
+
+        // Walk down as long as the node covers the address, any banned node on the way covers it as well
+        std::uint32_t index = 0;
+        while (index != NIL)
+        {
+            const auto &node = m_nodes[index];
+            if ((ip & prefixMask(node.len)) != node.prefix)
+            {
+                return false;
+            }
+
+            if (node.banned)
+            {
+                return true;
+            }
+
+            if (node.len == 32)
+            {
+                return false;
+            }
+
+            index = node.children[bitAt(ip, node.len)];
+        }
+
+        return false;
+    }
+
+    bool BanIndex::addAuthID(std::string_view authID)
+    {
+        return !authID.empty() && m_authIDs.emplace(authID).second;
+    }
+
+    bool BanIndex::removeAuthID(std::string_view authID)
+    {
+        return m_authIDs.erase(std::string(authID)) != 0;
+    }
+
+    bool BanIndex::isAuthIDBanned(std::string_view authID) const
+    {
+        return !m_authIDs.empty() && m_authIDs.find(std::string(authID)) != m_authIDs.end();
+    }
+
+    std::size_t BanIndex::getAddressesNum() const
+    {
+        return m_addressesNum;
+    }
+
+    std::size_t BanIndex::getAuthIDsNum() const
+    {
+        return m_authIDs.size();
+    }
+
+    bool BanIndex::save()
+    {
+        auto tmpPath = m_path;
+        tmpPath += ".tmp";
+
+        {
+            std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+            {
+                return false;
+            }
+
+            file.write(FILE_MAGIC.data(), FILE_MAGIC.size());
+            writeLittleEndian(file, FILE_VERSION);
+            writeLittleEndian(file, static_cast<std::uint32_t>(m_addressesNum));
+            writeLittleEndian(file, static_cast<std::uint32_t>(m_authIDs.size()));
+
+            for (const auto &node : m_nodes)
+            {
+                if (node.len != FREE_NODE && node.banned)
+                {
+                    writeLittleEndian(file, node.prefix);
+                    writeLittleEndian(file, static_cast<std::uint32_t>(node.len));
+                }
+            }
+
+            for (const auto &authID : m_authIDs)
+            {
+                auto len = static_cast<std::uint16_t>(std::min<std::size_t>(authID.length(), 0xFFFF));
+                writeLittleEndian(file, len);
+                file.write(authID.data(), len);
+            }
+
+            if (!file.good())
+            {
+                return false;
+            }
+        }
+
+        std::error_code errorCode;
+        std::filesystem::rename(tmpPath, m_path, errorCode);
+
+        return !errorCode;
+    }
+
+    void BanIndex::load()
+    {
+        using namespace std::string_literals;
+
+        _clear();
+
+        if (!std::filesystem::exists(m_path))
+        {
+            return;
+        }
+
+        MappedFile file(m_path);
+        if (!file.data() && std::filesystem::file_size(m_path))
+        {
+            throw std::runtime_error("Cannot map ban index file "s + m_path.string());
+        }
+
+        if (!file.data())
+        {
+            return;
+        }
+
+        const std::uint8_t *data = file.data();
+        const std::uint8_t *end = data + file.size();
+
+        if (file.size() < FILE_HEADER_SIZE)
+        {
+            throw std::runtime_error("Ban index file is truncated");
+        }
+
+        if (std::memcmp(data, FILE_MAGIC.data(), FILE_MAGIC.size()) != 0 ||
+            readLittleEndian<std::uint32_t>(data + 4) != FILE_VERSION)
+        {
+            throw std::runtime_error("Ban index file has unknown format");
+        }
+
+        auto addressesNum = readLittleEndian<std::uint32_t>(data + 8);
+        auto authIDsNum = readLittleEndian<std::uint32_t>(data + 12);
+        data += FILE_HEADER_SIZE;
+
+        if (static_cast<std::size_t>(end - data) / FILE_ADDRESS_SIZE < addressesNum)
+        {
+            throw std::runtime_error("Ban index file is truncated");
+        }
+
+        m_nodes.reserve(static_cast<std::size_t>(addressesNum) * 2);
+        for (std::uint32_t i = 0; i < addressesNum; i++, data += FILE_ADDRESS_SIZE)
+        {
+            auto ip = readLittleEndian<std::uint32_t>(data);
+            auto prefixLen = readLittleEndian<std::uint32_t>(data + 4);
+
+            if (prefixLen <= 32)
+            {
+                auto len = static_cast<std::uint8_t>(prefixLen);
+                _insert(ip & prefixMask(len), len);
+            }
+        }
+
+        m_authIDs.reserve(authIDsNum);
+        for (std::uint32_t i = 0; i < authIDsNum; i++)
+        {
+            if (static_cast<std::size_t>(end - data) < sizeof(std::uint16_t))
+            {
+                throw std::runtime_error("Ban index file is truncated");
+            }
+            auto len = readLittleEndian<std::uint16_t>(data);
+            data += sizeof(len);
+
+            if (static_cast<std::size_t>(end - data) < len)
+            {
+                throw std::runtime_error("Ban index file is truncated");
+            }
+            addAuthID({reinterpret_cast<const char *>(data), len});
+            data += len;
+        }
+    }
+
+    bool BanIndex::_parseCidr(std::string_view cidr, std::uint32_t &ip, std::uint8_t &len)
+    {
+        len = 32;
+
+        if (auto slashPos = cidr.find('/'); slashPos != std::string_view::npos)
+        {
+            std::string_view lenStr = cidr.substr(slashPos + 1);
+            if (lenStr.empty() || lenStr.length() > 2)
+            {
+                return false;
+            }
+
+            std::uint32_t value = 0;
+            for (char c : lenStr)
+            {
+                if (c < '0' || c > '9')
+                {
+                    return false;
+                }
+                value = value * 10 + static_cast<std::uint32_t>(c - '0');
+            }
+
+            if (value > 32)
+            {
+                return false;
+            }
+
+            len = static_cast<std::uint8_t>(value);
+            cidr = cidr.substr(0, slashPos);
+        }
+
+        // Port is not a part of the range
+        if (cidr.find(':') != std::string_view::npos || !Utils::parseIPv4(cidr, ip))
+        {
+            return false;
+        }
+
+        ip &= prefixMask(len);
+        return true;
+    }
+
+    bool BanIndex::_insert(std::uint32_t ip, std::uint8_t len)
+    {
+        std::uint32_t index = 0;
+        while (true)
+        {
+            // Node covers the inserted range here
+            if (m_nodes[index].len == len)
+            {
+                if (m_nodes[index].banned)
+                {
+                    return false;
+                }
+
+                m_nodes[index].banned = true;
+                m_addressesNum++;
+                return true;
+            }
+
+            std::uint32_t bit = bitAt(ip, m_nodes[index].len);
+            std::uint32_t childIndex = m_nodes[index].children[bit];
+
+            if (childIndex == NIL)
+            {
+                auto leaf = _allocNode(ip, len, true);
+                m_nodes[index].children[bit] = leaf;
+                m_addressesNum++;
+                return true;
+            }
+
+            const auto &child = m_nodes[childIndex];
+            auto common = commonPrefixLen(child.prefix, ip, std::min(child.len, len));
+
+            if (common == child.len)
+            {
+                index = childIndex;
+                continue;
+            }
+
+            // Child diverges from the inserted range, split the edge
+            auto childBit = bitAt(child.prefix, common);
+            auto split = _allocNode(ip & prefixMask(common), common, common == len);
+            m_nodes[split].children[childBit] = childIndex;
+            m_nodes[index].children[bit] = split;
+
+            if (common != len)
+            {
+                auto leaf = _allocNode(ip, len, true);
+                m_nodes[split].children[bitAt(ip, common)] = leaf;
+            }
+
+            m_addressesNum++;
+            return true;
+        }
+    }
+
+    bool BanIndex::_erase(std::uint32_t ip, std::uint8_t len)
+    {
+        std::uint32_t index = 0;
+        std::uint32_t parent = NIL;
+        std::uint32_t grandParent = NIL;
+
+        while (m_nodes[index].len != len)
+        {
+            const auto &node = m_nodes[index];
+            if (node.len > len || (ip & prefixMask(node.len)) != node.prefix)
+            {
+                return false;
+            }
+
+            std::uint32_t childIndex = node.children[bitAt(ip, node.len)];
+            if (childIndex == NIL)
+            {
+                return false;
+            }
+
+            grandParent = parent;
+            parent = index;
+            index = childIndex;
+        }
+
+        if (m_nodes[index].prefix != ip || !m_nodes[index].banned)
+        {
+            return false;
+        }
+
+        m_nodes[index].banned = false;
+        m_addressesNum--;
+        _prune(index, parent, grandParent);
+
+        return true;
+    }
+
+    void BanIndex::_prune(std::uint32_t index, std::uint32_t parent, std::uint32_t grandParent)
+    {
+        // Root always stays
+        if (parent == NIL)
+        {
+            return;
+        }
+
+        const auto &children = m_nodes[index].children;
+        bool hasLeft = children[0] != NIL;
+        bool hasRight = children[1] != NIL;
+
+        if (hasLeft && hasRight)
+        {
+            return;
+        }
+
+        if (hasLeft || hasRight)
+        {
+            _replaceChild(parent, index, hasLeft ? children[0] : children[1]);
+            _freeNode(index);
+            return;
+        }
+
+        _replaceChild(parent, index, NIL);
+        _freeNode(index);
+
+        // Parent might have been a split node which is not needed anymore
+        const auto &parentNode = m_nodes[parent];
+        if (grandParent == NIL || parentNode.banned)
+        {
+            return;
+        }
+
+        auto remaining = (parentNode.children[0] != NIL) ? parentNode.children[0] : parentNode.children[1];
+        _replaceChild(grandParent, parent, remaining);
+        _freeNode(parent);
+    }
+
+    void BanIndex::_replaceChild(std::uint32_t parent, std::uint32_t child, std::uint32_t newChild)
+    {
+        auto &children = m_nodes[parent].children;
+        children[(children[0] == child) ? 0 : 1] = newChild;
+    }
+
+    std::uint32_t BanIndex::_allocNode(std::uint32_t prefix, std::uint8_t len, bool banned)
+    {
+        std::uint32_t index;
+        if (!m_freeNodes.empty())
+        {
+            index = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            index = static_cast<std::uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        m_nodes[index] = {prefix, len, banned, {NIL, NIL}};
+        return index;
+    }
+
+    void BanIndex::_freeNode(std::uint32_t index)
+    {
+        m_nodes[index].len = FREE_NODE;
+        m_nodes[index].banned = false;
+        m_freeNodes.push_back(index);
+    }
+
+    void BanIndex::_clear()
+    {
+        m_nodes.assign(1, Node());
+        m_freeNodes.clear();
+        m_addressesNum = 0;
+        m_authIDs.clear();
+    }
+} // namespace Anubis
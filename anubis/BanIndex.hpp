@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <IBanIndex.hpp>
+
+#include <array>
+#include <filesystem>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Anubis
+{
+    class BanIndex final : public IBanIndex
+    {
+    public:
+        static constexpr std::string_view REJECT_REASON = "You are banned from this server";
+
+    public:
+        explicit BanIndex(std::filesystem::path path);
+        ~BanIndex() final = default;
+
+        bool addAddress(std::string_view cidr) final;
+        bool removeAddress(std::string_view cidr) final;
+        [[nodiscard]] bool isAddressBanned(std::string_view address) const final;
+        bool addAuthID(std::string_view authID) final;
+        bool removeAuthID(std::string_view authID) final;
+        [[nodiscard]] bool isAuthIDBanned(std::string_view authID) const final;
+        [[nodiscard]] std::size_t getAddressesNum() const final;
+        [[nodiscard]] std::size_t getAuthIDsNum() const final;
+        bool save() final;
+
+        /* Throws std::runtime_error if the file is malformed, missing file leaves the index empty */
+        void load();
+
+    private:
+        static constexpr std::uint32_t NIL = 0xFFFFFFFF;
+        static constexpr std::uint8_t FREE_NODE = 0xFF;
+
+        /* Node covers all addresses whose first len bits are equal to prefix */
+        struct Node
+        {
+            std::uint32_t prefix = 0;
+            std::uint8_t len = 0;
+            bool banned = false;
+            std::array<std::uint32_t, 2> children = {NIL, NIL};
+        };
+
+        /* Layout of the file, all values are written as little endian regardless of the host:
+         * header of magic, u32 version, u32 number of addresses and u32 number of auth IDs,
+         * addresses as u32 ip and u32 prefix length, auth IDs as u16 length followed by the characters */
+        static constexpr std::size_t FILE_HEADER_SIZE = 16;
+        static constexpr std::size_t FILE_ADDRESS_SIZE = 8;
+        static constexpr std::array<char, 4> FILE_MAGIC = {'A', 'B', 'A', 'N'};
+        static constexpr std::uint32_t FILE_VERSION = 1;
+
+    private:
+        static bool _parseCidr(std::string_view cidr, std::uint32_t &ip, std::uint8_t &len);
+        bool _insert(std::uint32_t ip, std::uint8_t len);
+        bool _erase(std::uint32_t ip, std::uint8_t len);
+        void _prune(std::uint32_t index, std::uint32_t parent, std::uint32_t grandParent);
+        void _replaceChild(std::uint32_t parent, std::uint32_t child, std::uint32_t newChild);
+        std::uint32_t _allocNode(std::uint32_t prefix, std::uint8_t len, bool banned);
+        void _freeNode(std::uint32_t index);
+        void _clear();
+
+    private:
+        std::filesystem::path m_path;
+        std::vector<Node> m_nodes = std::vector<Node>(1);
+        std::vector<std::uint32_t> m_freeNodes;
+        std::size_t m_addressesNum = 0;
+        std::unordered_set<std::string> m_authIDs;
+    };
+} // namespace Anubis
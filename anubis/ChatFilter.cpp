@@ -0,0 +1,248 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ChatFilter.hpp"
+#include "Utils.hpp"
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+
+namespace Anubis
+{
+    void ChatFilter::load(const std::filesystem::path &path)
+    {
+        using namespace std::string_literals;
+
+        std::vector<Pattern> patterns;
+
+        if (std::filesystem::exists(path))
+        {
+            try
+            {
+#if defined __linux__
+                YAML::Node rootNode = YAML::LoadFile(path.c_str());
+#elif defined _WIN32
+                YAML::Node rootNode = YAML::LoadFile(path.string().c_str());
+#endif
+                for (const auto &patternNode : rootNode["patterns"])
+                {
+                    auto text = Utils::toLowerCopy(patternNode["text"].as<std::string>());
+                    if (text.empty())
+                    {
+                        continue;
+                    }
+
+                    auto actionName = Utils::toLowerCopy(patternNode["action"].as<std::string>("flag"));
+                    Action action;
+
+                    if (actionName == "block")
+                    {
+                        action = Action::Block;
+                    }
+                    else if (actionName == "replace")
+                    {
+                        action = Action::Replace;
+                    }
+                    else if (actionName == "flag")
+                    {
+                        action = Action::Flag;
+                    }
+                    else
+                    {
+                        throw std::runtime_error("Unknown action \""s + actionName + "\" of pattern \"" + text + '"');
+                    }
+
+                    auto replacement = patternNode["replacement"].as<std::string>(std::string(text.length(), '*'));
+                    patterns.push_back({std::move(text), std::move(replacement), action});
+                }
+            }
+            catch (const YAML::Exception &e)
+            {
+                throw std::runtime_error("Error parsing yaml chat filter file: "s + e.what());
+            }
+        }
+
+        m_patterns = std::move(patterns);
+        _compile();
+    }
+
+    ChatFilter::Action ChatFilter::filter(std::string_view message, std::string &replaced)
+    {
+        if (m_patterns.empty())
+        {
+            return Action::None;
+        }
+
+        m_matches.clear();
+
+        std::uint32_t state = 0;
+        for (std::size_t i = 0; i < message.length(); i++)
+        {
+            state = _next(state, message[i]);
+
+            auto node = (m_terminal[state] != NO_PATTERN) ? state : m_outputLink[state];
+            while (node)
+            {
+                for (auto pattern = m_terminal[node]; pattern != NO_PATTERN; pattern = m_nextSame[pattern])
+                {
+                    m_matches.push_back({i + 1 - m_patterns[pattern].text.length(), pattern});
+                }
+                node = m_outputLink[node];
+            }
+        }
+
+        auto action = Action::None;
+        for (const auto &match : m_matches)
+        {
+            auto &pattern = m_patterns[match.pattern];
+            pattern.hits++;
+            action = std::max(action, pattern.action);
+        }
+
+        if (action != Action::Replace)
+        {
+            return action;
+        }
+
+        // Replace leftmost matches first, the longest one if several start at the same position
+        std::sort(m_matches.begin(), m_matches.end(),
+                  [this](const Match &lhs, const Match &rhs)
+                  {
+                      if (lhs.start != rhs.start)
+                      {
+                          return lhs.start < rhs.start;
+                      }
+
+                      return m_patterns[lhs.pattern].text.length() > m_patterns[rhs.pattern].text.length();
+                  });
+
+        replaced.clear();
+        std::size_t pos = 0;
+        for (const auto &match : m_matches)
+        {
+            const auto &pattern = m_patterns[match.pattern];
+            if (pattern.action != Action::Replace || match.start < pos)
+            {
+                continue;
+            }
+
+            replaced.append(message.substr(pos, match.start - pos));
+            replaced.append(pattern.replacement);
+            pos = match.start + pattern.text.length();
+        }
+        replaced.append(message.substr(pos));
+
+        return action;
+    }
+
+    const std::vector<ChatFilter::Pattern> &ChatFilter::getPatterns() const
+    {
+        return m_patterns;
+    }
+
+    void ChatFilter::_compile()
+    {
+        // Symbol 0 stands for every character which does not appear in any pattern
+        m_alphabet.fill(0);
+        m_alphabetSize = 1;
+        for (const auto &pattern : m_patterns)
+        {
+            for (unsigned char c : pattern.text)
+            {
+                if (!m_alphabet[c])
+                {
+                    m_alphabet[c] = static_cast<std::uint16_t>(m_alphabetSize++);
+                }
+            }
+        }
+
+        // Patterns are lower case, fold upper case letters into the same symbols
+        for (unsigned char c = 'A'; c <= 'Z'; c++)
+        {
+            m_alphabet[c] = m_alphabet[c - 'A' + 'a'];
+        }
+
+        m_transitions.assign(m_alphabetSize, 0);
+        m_terminal.assign(1, NO_PATTERN);
+        m_nextSame.assign(m_patterns.size(), NO_PATTERN);
+
+        for (std::uint32_t i = 0; i < m_patterns.size(); i++)
+        {
+            std::uint32_t state = 0;
+            for (unsigned char c : m_patterns[i].text)
+            {
+                auto &next = m_transitions[state * m_alphabetSize + m_alphabet[c]];
+                if (!next)
+                {
+                    next = static_cast<std::uint32_t>(m_terminal.size());
+                    m_terminal.push_back(NO_PATTERN);
+                    m_transitions.resize(m_transitions.size() + m_alphabetSize, 0);
+                }
+
+                state = m_transitions[state * m_alphabetSize + m_alphabet[c]];
+            }
+
+            m_nextSame[i] = m_terminal[state];
+            m_terminal[state] = i;
+        }
+
+        // Complete the trie into automaton, missing transitions follow the failure links
+        std::vector<std::uint32_t> failure(m_terminal.size(), 0);
+        m_outputLink.assign(m_terminal.size(), 0);
+
+        std::queue<std::uint32_t> queue;
+        for (std::uint32_t symbol = 0; symbol < m_alphabetSize; symbol++)
+        {
+            if (auto child = m_transitions[symbol]; child)
+            {
+                queue.push(child);
+            }
+        }
+
+        while (!queue.empty())
+        {
+            auto state = queue.front();
+            queue.pop();
+
+            for (std::uint32_t symbol = 0; symbol < m_alphabetSize; symbol++)
+            {
+                auto &next = m_transitions[state * m_alphabetSize + symbol];
+                auto fallback = m_transitions[failure[state] * m_alphabetSize + symbol];
+
+                if (!next)
+                {
+                    next = fallback;
+                    continue;
+                }
+
+                failure[next] = fallback;
+                m_outputLink[next] = (m_terminal[fallback] != NO_PATTERN) ? fallback : m_outputLink[fallback];
+                queue.push(next);
+            }
+        }
+    }
+
+    std::uint32_t ChatFilter::_next(std::uint32_t state, char c) const
+    {
+        return m_transitions[state * m_alphabetSize + m_alphabet[static_cast<unsigned char>(c)]];
+    }
+} // namespace Anubis
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Anubis
+{
+    /* Multi-pattern matcher for say and say_team messages.
+     * Patterns are compiled into Aho-Corasick automaton, so matching is linear in message length. */
+    class ChatFilter
+    {
+    public:
+        enum class Action : std::uint8_t
+        {
+            None = 0,
+            Flag,
+            Replace,
+            Block
+        };
+
+        struct Pattern
+        {
+            std::string text;
+            std::string replacement;
+            Action action;
+            std::uint64_t hits = 0;
+        };
+
+    public:
+        /* Throws std::runtime_error if file cannot be parsed, missing file clears the patterns */
+        void load(const std::filesystem::path &path);
+
+        /* Returns the strongest action of matched patterns, replaced message is set only for Action::Replace */
+        Action filter(std::string_view message, std::string &replaced);
+        [[nodiscard]] const std::vector<Pattern> &getPatterns() const;
+
+    private:
+        struct Match
+        {
+            std::size_t start;
+            std::uint32_t pattern;
+        };
+
+    private:
+        void _compile();
+        [[nodiscard]] std::uint32_t _next(std::uint32_t state, char c) const;
+
+    private:
+        static constexpr std::uint32_t NO_PATTERN = 0xFFFFFFFF;
+
+        std::vector<Pattern> m_patterns;
+        std::array<std::uint16_t, 256> m_alphabet {};
+        std::uint32_t m_alphabetSize = 1;
+        std::vector<std::uint32_t> m_transitions;
+        std::vector<std::uint32_t> m_terminal;
+        std::vector<std::uint32_t> m_outputLink;
+        std::vector<std::uint32_t> m_nextSame;
+        std::vector<Match> m_matches;
+    };
+} // namespace Anubis
@@ -0,0 +1,191 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "CmdLimiter.hpp"
+
+#include <game/IClientCmdArgs.hpp>
+
+#include <algorithm>
+#include <cctype>
+
+namespace Anubis
+{
+    CmdLimiter::CmdLimiter(std::vector<CmdLimitClass> classes, std::uint32_t slotsNum)
+        : m_classes(std::move(classes)),
+          m_stats(m_classes.size()),
+          m_slotsNum(slotsNum + 1),
+          m_buckets(m_slotsNum * m_classes.size()),
+          m_delayedCmds(m_slotsNum)
+    {
+        for (std::size_t i = 0; i < m_classes.size(); i++)
+        {
+            if (m_classes[i].commands.empty())
+            {
+                m_defaultClass = i;
+                continue;
+            }
+
+            for (const auto &command : m_classes[i].commands)
+            {
+                m_classByHash[Game::hashClientCmdName(command)].emplace_back(command, i);
+            }
+        }
+    }
+
+    CmdLimiter::Verdict CmdLimiter::check(std::uint32_t slot, std::string_view cmd, std::string_view args, float time)
+    {
+        auto cmdClass = _findClass(cmd);
+        if (cmdClass == NO_CLASS || slot >= m_slotsNum)
+        {
+            return Verdict::Allow;
+        }
+
+        auto &stats = m_stats[cmdClass];
+
+        // Keep the order of the commands, delayed ones cannot be overtaken by the same class
+        const auto &delayedCmds = m_delayedCmds[slot];
+        bool classDelayed = std::any_of(delayedCmds.cbegin(), delayedCmds.cend(),
+                                        [cmdClass](const DelayedCmd &delayedCmd)
+                                        {
+                                            return delayedCmd.cmdClass == cmdClass;
+                                        });
+
+        if (!classDelayed && _consume(slot, cmdClass, time))
+        {
+            stats.allowed++;
+            return Verdict::Allow;
+        }
+
+        switch (m_classes[cmdClass].action)
+        {
+            case CmdLimitAction::Delay:
+                if (m_delayedCmds[slot].size() < MAX_DELAYED_CMDS)
+                {
+                    m_delayedCmds[slot].push_back({std::string(cmd), std::string(args), cmdClass});
+                    m_delayedCmdsNum++;
+                    stats.delayed++;
+                    return Verdict::Delay;
+                }
+                stats.dropped++;
+                return Verdict::Drop;
+            case CmdLimitAction::Kick:
+                stats.kicked++;
+                return Verdict::Kick;
+            case CmdLimitAction::Drop:
+                break;
+        }
+
+        stats.dropped++;
+        return Verdict::Drop;
+    }
+
+    void CmdLimiter::runDelayed(float time, const DelayedCmdExecutor &executor)
+    {
+        if (!m_delayedCmdsNum)
+        {
+            return;
+        }
+
+        for (std::uint32_t slot = 0; slot < m_slotsNum; slot++)
+        {
+            auto &delayedCmds = m_delayedCmds[slot];
+            while (!delayedCmds.empty() && _consume(slot, delayedCmds.front().cmdClass, time))
+            {
+                // Executor can reset the slot, so the command is moved out first
+                DelayedCmd cmd = std::move(delayedCmds.front());
+                delayedCmds.pop_front();
+                m_delayedCmdsNum--;
+
+                m_stats[cmd.cmdClass].allowed++;
+                executor(slot, cmd);
+            }
+        }
+    }
+
+    void CmdLimiter::resetSlot(std::uint32_t slot)
+    {
+        if (slot >= m_slotsNum)
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i < m_classes.size(); i++)
+        {
+            m_buckets[slot * m_classes.size() + i] = Bucket();
+        }
+
+        m_delayedCmdsNum -= m_delayedCmds[slot].size();
+        m_delayedCmds[slot].clear();
+    }
+
+    const std::vector<CmdLimitClass> &CmdLimiter::getClasses() const
+    {
+        return m_classes;
+    }
+
+    const std::vector<CmdLimiter::Stats> &CmdLimiter::getStats() const
+    {
+        return m_stats;
+    }
+
+    std::size_t CmdLimiter::_findClass(std::string_view cmd) const
+    {
+        if (auto it = m_classByHash.find(Game::hashClientCmdName(cmd)); it != m_classByHash.end())
+        {
+            for (const auto &[name, cmdClass] : it->second)
+            {
+                if (std::equal(name.cbegin(), name.cend(), cmd.cbegin(), cmd.cend(),
+                               [](char a, char b)
+                               {
+                                   return a == std::tolower(static_cast<unsigned char>(b));
+                               }))
+                {
+                    return cmdClass;
+                }
+            }
+        }
+
+        return m_defaultClass;
+    }
+
+    bool CmdLimiter::_consume(std::uint32_t slot, std::size_t cmdClass, float time)
+    {
+        const auto &limits = m_classes[cmdClass];
+        auto &bucket = m_buckets[slot * m_classes.size() + cmdClass];
+
+        // Fresh bucket starts full, time going back (e.g. map change) does not refill it
+        if (bucket.lastTime < 0.0f)
+        {
+            bucket.tokens = limits.burst;
+        }
+        else if (time > bucket.lastTime)
+        {
+            bucket.tokens = std::min(limits.burst, bucket.tokens + (time - bucket.lastTime) * limits.rate);
+        }
+        bucket.lastTime = time;
+
+        if (bucket.tokens < 1.0f)
+        {
+            return false;
+        }
+
+        bucket.tokens -= 1.0f;
+        return true;
+    }
+} // namespace Anubis
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "AnubisConfig.hpp"
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Anubis
+{
+    /* Token bucket limiter of client commands, one bucket per client slot and command class */
+    class CmdLimiter
+    {
+    public:
+        enum class Verdict : std::uint8_t
+        {
+            Allow = 0,
+            Drop,
+            Delay,
+            Kick
+        };
+
+        struct DelayedCmd
+        {
+            std::string name;
+            std::string args;
+            std::size_t cmdClass;
+        };
+
+        struct Stats
+        {
+            std::uint64_t allowed = 0;
+            std::uint64_t dropped = 0;
+            std::uint64_t delayed = 0;
+            std::uint64_t kicked = 0;
+        };
+
+        using DelayedCmdExecutor = std::function<void(std::uint32_t slot, const DelayedCmd &cmd)>;
+
+    public:
+        /* Commands delayed above this limit are dropped */
+        static constexpr std::size_t MAX_DELAYED_CMDS = 16;
+
+    public:
+        CmdLimiter(std::vector<CmdLimitClass> classes, std::uint32_t slotsNum);
+
+        /* Slot is the index of the client's edict */
+        Verdict check(std::uint32_t slot, std::string_view cmd, std::string_view args, float time);
+        void runDelayed(float time, const DelayedCmdExecutor &executor);
+        void resetSlot(std::uint32_t slot);
+
+        [[nodiscard]] const std::vector<CmdLimitClass> &getClasses() const;
+        [[nodiscard]] const std::vector<Stats> &getStats() const;
+
+    private:
+        struct Bucket
+        {
+            float tokens = 0.0f;
+            float lastTime = -1.0f;
+        };
+
+    private:
+        [[nodiscard]] std::size_t _findClass(std::string_view cmd) const;
+        bool _consume(std::uint32_t slot, std::size_t cmdClass, float time);
+
+    private:
+        static constexpr std::size_t NO_CLASS = static_cast<std::size_t>(-1);
+
+        std::vector<CmdLimitClass> m_classes;
+        std::vector<Stats> m_stats;
+        std::unordered_map<std::uint32_t, std::vector<std::pair<std::string_view, std::size_t>>> m_classByHash;
+        std::size_t m_defaultClass = NO_CLASS;
+        std::uint32_t m_slotsNum;
+        std::vector<Bucket> m_buckets;
+        std::vector<std::deque<DelayedCmd>> m_delayedCmds;
+        std::size_t m_delayedCmdsNum = 0;
+    };
+} // namespace Anubis
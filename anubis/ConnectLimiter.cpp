@@ -0,0 +1,185 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ConnectLimiter.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Anubis
+{
+    ConnectLimiter::ConnectLimiter(ConnectLimits limits)
+        : m_limits(std::move(limits)),
+          m_mask(m_limits.prefixLen ? 0xFFFFFFFFu << (32 - m_limits.prefixLen) : 0u)
+    {
+        m_sources.reserve(m_limits.sourcesNum);
+        m_sourceByKey.reserve(m_limits.sourcesNum);
+    }
+
+    bool ConnectLimiter::check(std::string_view address, float time)
+    {
+        std::uint32_t ip;
+        if (m_limits.rate <= 0.0f || !Utils::parseIPv4(address, ip))
+        {
+            return true;
+        }
+
+        auto &source = m_sources[_acquire(ip & m_mask, time)];
+
+        // Time going back (e.g. map change) does not refill the bucket
+        if (time > source.lastTime)
+        {
+            source.tokens = std::min(m_limits.burst, source.tokens + (time - source.lastTime) * m_limits.rate);
+        }
+        source.lastTime = time;
+
+        bool allowed = source.tokens >= 1.0f;
+        if (allowed)
+        {
+            source.tokens -= 1.0f;
+        }
+
+        _count(time, !allowed);
+        return allowed;
+    }
+
+    std::string_view ConnectLimiter::getReason() const
+    {
+        return m_limits.reason;
+    }
+
+    ConnectLimiter::Stats ConnectLimiter::getStats(float time) const
+    {
+        Stats stats;
+        stats.attempts = m_attempts;
+        stats.rejected = m_rejected;
+        stats.sourcesNum = m_sources.size();
+
+        auto now = static_cast<std::int64_t>(std::floor(time));
+        for (const auto &second : m_window)
+        {
+            if (second.second >= 0 && second.second > now - RATE_WINDOW && second.second <= now)
+            {
+                stats.attemptsRate += static_cast<float>(second.attempts);
+                stats.rejectedRate += static_cast<float>(second.rejected);
+            }
+        }
+        stats.attemptsRate /= RATE_WINDOW;
+        stats.rejectedRate /= RATE_WINDOW;
+
+        return stats;
+    }
+
+    std::uint32_t ConnectLimiter::_acquire(std::uint32_t key, float time)
+    {
+        if (auto it = m_sourceByKey.find(key); it != m_sourceByKey.end())
+        {
+            _unlink(it->second);
+            _pushFront(it->second);
+            return it->second;
+        }
+
+        std::uint32_t index;
+        if (m_sources.size() < m_limits.sourcesNum)
+        {
+            index = static_cast<std::uint32_t>(m_sources.size());
+            m_sources.emplace_back();
+        }
+        else
+        {
+            // Forget the least recently seen source
+            index = m_tail;
+            _unlink(index);
+            m_sourceByKey.erase(m_sources[index].key);
+        }
+
+        auto &source = m_sources[index];
+        source.key = key;
+        source.tokens = m_limits.burst;
+        source.lastTime = time;
+
+        m_sourceByKey.emplace(key, index);
+        _pushFront(index);
+        return index;
+    }
+
+    void ConnectLimiter::_unlink(std::uint32_t index)
+    {
+        auto &source = m_sources[index];
+
+        if (source.prev != NIL)
+        {
+            m_sources[source.prev].next = source.next;
+        }
+        else
+        {
+            m_head = source.next;
+        }
+
+        if (source.next != NIL)
+        {
+            m_sources[source.next].prev = source.prev;
+        }
+        else
+        {
+            m_tail = source.prev;
+        }
+
+        source.prev = source.next = NIL;
+    }
+
+    void ConnectLimiter::_pushFront(std::uint32_t index)
+    {
+        auto &source = m_sources[index];
+        source.prev = NIL;
+        source.next = m_head;
+
+        if (m_head != NIL)
+        {
+            m_sources[m_head].prev = index;
+        }
+        m_head = index;
+
+        if (m_tail == NIL)
+        {
+            m_tail = index;
+        }
+    }
+
+    void ConnectLimiter::_count(float time, bool rejected)
+    {
+        auto now = static_cast<std::int64_t>(std::floor(time));
+        auto &second = m_window[static_cast<std::size_t>(now % RATE_WINDOW)];
+
+        if (second.second != now)
+        {
+            second = {now, 0, 0};
+        }
+
+        second.attempts++;
+        m_attempts++;
+
+        if (rejected)
+        {
+            second.rejected++;
+            m_rejected++;
+        }
+    }
+} // namespace Anubis
@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "AnubisConfig.hpp"
+
+#include <array>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Anubis
+{
+    /* Token bucket limiter of connection attempts keyed by source address prefix.
+     * Sources are kept in LRU order, the least recently seen one is reused when the table is full. */
+    class ConnectLimiter
+    {
+    public:
+        struct Stats
+        {
+            std::uint64_t attempts = 0;
+            std::uint64_t rejected = 0;
+            float attemptsRate = 0.0f; // per second, averaged over the last RATE_WINDOW seconds
+            float rejectedRate = 0.0f;
+            std::size_t sourcesNum = 0;
+        };
+
+    public:
+        static constexpr std::uint32_t RATE_WINDOW = 10;
+
+    public:
+        explicit ConnectLimiter(ConnectLimits limits);
+
+        /* Returns false if the attempt should be rejected */
+        bool check(std::string_view address, float time);
+        [[nodiscard]] std::string_view getReason() const;
+        [[nodiscard]] Stats getStats(float time) const;
+
+    private:
+        static constexpr std::uint32_t NIL = 0xFFFFFFFF;
+
+        struct Source
+        {
+            std::uint32_t key = 0;
+            float tokens = 0.0f;
+            float lastTime = 0.0f;
+            std::uint32_t prev = NIL;
+            std::uint32_t next = NIL;
+        };
+
+        /* Attempts counted per second of the sliding window */
+        struct Second
+        {
+            std::int64_t second = -1;
+            std::uint32_t attempts = 0;
+            std::uint32_t rejected = 0;
+        };
+
+    private:
+        std::uint32_t _acquire(std::uint32_t key, float time);
+        void _unlink(std::uint32_t index);
+        void _pushFront(std::uint32_t index);
+        void _count(float time, bool rejected);
+
+    private:
+        ConnectLimits m_limits;
+        std::uint32_t m_mask;
+        std::vector<Source> m_sources;
+        std::unordered_map<std::uint32_t, std::uint32_t> m_sourceByKey;
+        std::uint32_t m_head = NIL;
+        std::uint32_t m_tail = NIL;
+        std::array<Second, RATE_WINDOW> m_window;
+        std::uint64_t m_attempts = 0;
+        std::uint64_t m_rejected = 0;
+    };
+} // namespace Anubis
@@ -0,0 +1,354 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "CvarQueries.hpp"
+
+#include <engine/ILibrary.hpp>
+#include <engine/IEdict.hpp>
+
+#include <algorithm>
+#include <cctype>
+
+namespace Anubis
+{
+    namespace
+    {
+        bool equalsIgnoreCase(std::string_view a, std::string_view b)
+        {
+            return std::equal(a.cbegin(), a.cend(), b.cbegin(), b.cend(),
+                              [](char c1, char c2)
+                              {
+                                  return std::tolower(static_cast<unsigned char>(c1)) ==
+                                         std::tolower(static_cast<unsigned char>(c2));
+                              });
+        }
+    } // namespace
+
+    CvarQueries::CvarQueries(nstd::observer_ptr<Engine::ILibrary> engine, std::uint32_t slotsNum)
+        : m_engine(engine),
+          m_slots(slotsNum + 1)
+    {
+    }
+
+    CvarQueryId CvarQueries::query(nstd::observer_ptr<Engine::IEdict> player,
+                                   std::string_view cvarName,
+                                   CvarQueryCallback callback,
+                                   float timeout)
+    {
+        if (!player || !callback || cvarName.empty())
+        {
+            return INVALID_CVAR_QUERY;
+        }
+
+        std::uint32_t slotIndex = player->getIndex();
+        if (!slotIndex || slotIndex >= m_slots.size())
+        {
+            return INVALID_CVAR_QUERY;
+        }
+
+        // Skip the invalid handle on wrap around
+        if (++m_lastId == INVALID_CVAR_QUERY)
+        {
+            ++m_lastId;
+        }
+
+        auto &slot = m_slots[slotIndex];
+        slot.player = player;
+
+        Waiter waiter {m_lastId, std::move(callback), m_engine->getTime() + timeout};
+        auto it = std::find_if(slot.queries.begin(), slot.queries.end(),
+                               [cvarName](const WireQuery &query)
+                               {
+                                   return equalsIgnoreCase(query.cvarName, cvarName);
+                               });
+
+        if (it != slot.queries.end())
+        {
+            it->waiters.push_back(std::move(waiter));
+        }
+        else
+        {
+            auto &query = slot.queries.emplace_back();
+            query.cvarName = cvarName;
+            query.waiters.push_back(std::move(waiter));
+        }
+
+        m_slotById.emplace(m_lastId, slotIndex);
+        _send(slotIndex);
+
+        return CvarQueryId(m_lastId);
+    }
+
+    bool CvarQueries::cancel(CvarQueryId id)
+    {
+        auto slotIt = m_slotById.find(id);
+        if (slotIt == m_slotById.end())
+        {
+            return false;
+        }
+
+        std::uint32_t slotIndex = slotIt->second;
+        m_slotById.erase(slotIt);
+
+        auto &slot = m_slots[slotIndex];
+        for (auto it = slot.queries.begin(); it != slot.queries.end(); ++it)
+        {
+            auto &waiters = it->waiters;
+            auto waiterIt = std::find_if(waiters.begin(), waiters.end(),
+                                         [id](const Waiter &waiter)
+                                         {
+                                             return waiter.id == id;
+                                         });
+
+            if (waiterIt == waiters.end())
+            {
+                continue;
+            }
+
+            waiters.erase(waiterIt);
+
+            // Late response of the sent query is still recognized by its range and ignored
+            if (waiters.empty())
+            {
+                if (it->sent)
+                {
+                    slot.inFlight--;
+                }
+                slot.queries.erase(it);
+                _send(slotIndex);
+            }
+            return true;
+        }
+
+        return false;
+    }
+
+    std::size_t CvarQueries::getPendingNum(nstd::observer_ptr<Engine::IEdict> player) const
+    {
+        std::uint32_t slotIndex = player->getIndex();
+        if (slotIndex >= m_slots.size())
+        {
+            return 0;
+        }
+
+        std::size_t pendingNum = 0;
+        for (const auto &query : m_slots[slotIndex].queries)
+        {
+            pendingNum += query.waiters.size();
+        }
+
+        return pendingNum;
+    }
+
+    bool CvarQueries::handleResponse(nstd::observer_ptr<Engine::IEdict> player,
+                                     std::uint32_t requestID,
+                                     std::string_view value)
+    {
+        if (requestID < FIRST_RESERVED_REQUEST_ID || requestID > LAST_RESERVED_REQUEST_ID)
+        {
+            return false;
+        }
+
+        std::uint32_t slotIndex = player->getIndex();
+        if (slotIndex >= m_slots.size())
+        {
+            return true;
+        }
+
+        auto &slot = m_slots[slotIndex];
+        auto it = std::find_if(slot.queries.begin(), slot.queries.end(),
+                               [requestID](const WireQuery &query)
+                               {
+                                   return query.sent && query.requestID == requestID;
+                               });
+
+        if (it == slot.queries.end())
+        {
+            return true;
+        }
+
+        // Callbacks can query or cancel, so the query is taken out first
+        WireQuery query = std::move(*it);
+        slot.queries.erase(it);
+        slot.inFlight--;
+
+        for (const auto &waiter : query.waiters)
+        {
+            m_slotById.erase(waiter.id);
+        }
+
+        _send(slotIndex);
+        _notify(player, query, query.waiters, value, CvarQueryStatus::Answered);
+
+        return true;
+    }
+
+    void CvarQueries::update(float time)
+    {
+        // Time goes back on map change, keep the remaining time of the queries
+        if (time < m_lastTime)
+        {
+            for (auto &slot : m_slots)
+            {
+                for (auto &query : slot.queries)
+                {
+                    for (auto &waiter : query.waiters)
+                    {
+                        waiter.deadline -= m_lastTime - time;
+                    }
+                }
+            }
+        }
+        m_lastTime = time;
+
+        if (m_slotById.empty())
+        {
+            return;
+        }
+
+        for (std::uint32_t slotIndex = 1; slotIndex < m_slots.size(); slotIndex++)
+        {
+            auto &slot = m_slots[slotIndex];
+            if (slot.queries.empty())
+            {
+                continue;
+            }
+
+            std::vector<std::pair<WireQuery, std::vector<Waiter>>> expired;
+            for (auto it = slot.queries.begin(); it != slot.queries.end();)
+            {
+                auto &waiters = it->waiters;
+                auto expiredIt = std::stable_partition(waiters.begin(), waiters.end(),
+                                                       [time](const Waiter &waiter)
+                                                       {
+                                                           return waiter.deadline > time;
+                                                       });
+
+                if (expiredIt == waiters.end())
+                {
+                    ++it;
+                    continue;
+                }
+
+                std::vector<Waiter> expiredWaiters(std::make_move_iterator(expiredIt),
+                                                   std::make_move_iterator(waiters.end()));
+                waiters.erase(expiredIt, waiters.end());
+
+                for (const auto &waiter : expiredWaiters)
+                {
+                    m_slotById.erase(waiter.id);
+                }
+
+                if (waiters.empty())
+                {
+                    if (it->sent)
+                    {
+                        slot.inFlight--;
+                    }
+                    expired.emplace_back(std::move(*it), std::move(expiredWaiters));
+                    it = slot.queries.erase(it);
+                }
+                else
+                {
+                    expired.emplace_back(WireQuery {it->cvarName, {}}, std::move(expiredWaiters));
+                    ++it;
+                }
+            }
+
+            if (expired.empty())
+            {
+                continue;
+            }
+
+            auto player = slot.player;
+            _send(slotIndex);
+
+            for (const auto &[query, waiters] : expired)
+            {
+                _notify(player, query, waiters, {}, CvarQueryStatus::TimedOut);
+            }
+        }
+    }
+
+    void CvarQueries::resetSlot(std::uint32_t slotIndex)
+    {
+        if (slotIndex >= m_slots.size())
+        {
+            return;
+        }
+
+        auto &slot = m_slots[slotIndex];
+        auto player = slot.player;
+        auto queries = std::move(slot.queries);
+
+        slot.queries.clear();
+        slot.inFlight = 0;
+        slot.player = nullptr;
+
+        for (const auto &query : queries)
+        {
+            for (const auto &waiter : query.waiters)
+            {
+                m_slotById.erase(waiter.id);
+            }
+        }
+
+        for (const auto &query : queries)
+        {
+            _notify(player, query, query.waiters, {}, CvarQueryStatus::Dropped);
+        }
+    }
+
+    void CvarQueries::_send(std::uint32_t slotIndex)
+    {
+        auto &slot = m_slots[slotIndex];
+
+        for (auto &query : slot.queries)
+        {
+            if (slot.inFlight >= MAX_IN_FLIGHT)
+            {
+                return;
+            }
+
+            if (query.sent)
+            {
+                continue;
+            }
+
+            m_lastRequestID = (m_lastRequestID + 1) % (LAST_RESERVED_REQUEST_ID - FIRST_RESERVED_REQUEST_ID + 1);
+            query.requestID = FIRST_RESERVED_REQUEST_ID + m_lastRequestID;
+            query.sent = true;
+            slot.inFlight++;
+
+            m_engine->queryClientCvarValue2(slot.player, query.cvarName, query.requestID, FuncCallType::Hooks);
+        }
+    }
+
+    void CvarQueries::_notify(nstd::observer_ptr<Engine::IEdict> player,
+                              const WireQuery &query,
+                              const std::vector<Waiter> &waiters,
+                              std::string_view value,
+                              CvarQueryStatus status)
+    {
+        for (const auto &waiter : waiters)
+        {
+            waiter.callback(player, query.cvarName, value, status);
+        }
+    }
+} // namespace Anubis
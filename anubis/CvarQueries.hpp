@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <ICvarQueries.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Anubis
+{
+    namespace Engine
+    {
+        class ILibrary;
+    }
+
+    class CvarQueries final : public ICvarQueries
+    {
+    public:
+        /* Queries sent to the client and not answered yet, others wait until one of them is done */
+        static constexpr std::size_t MAX_IN_FLIGHT = 4;
+
+    public:
+        CvarQueries(nstd::observer_ptr<Engine::ILibrary> engine, std::uint32_t slotsNum);
+        ~CvarQueries() final = default;
+
+        CvarQueryId query(nstd::observer_ptr<Engine::IEdict> player,
+                          std::string_view cvarName,
+                          CvarQueryCallback callback,
+                          float timeout) final;
+        bool cancel(CvarQueryId id) final;
+        [[nodiscard]] std::size_t getPendingNum(nstd::observer_ptr<Engine::IEdict> player) const final;
+
+        /* Returns true if the request ID is from the reserved range, response is not passed further then */
+        bool handleResponse(nstd::observer_ptr<Engine::IEdict> player, std::uint32_t requestID, std::string_view value);
+        void update(float time);
+        void resetSlot(std::uint32_t slot);
+
+    private:
+        struct Waiter
+        {
+            CvarQueryId::BaseType id;
+            CvarQueryCallback callback;
+            float deadline;
+        };
+
+        /* Single query sent to the client, shared by all waiters asking for the same cvar */
+        struct WireQuery
+        {
+            std::string cvarName;
+            std::vector<Waiter> waiters;
+            std::uint32_t requestID = 0;
+            bool sent = false;
+        };
+
+        struct Slot
+        {
+            nstd::observer_ptr<Engine::IEdict> player;
+            std::vector<WireQuery> queries;
+            std::size_t inFlight = 0;
+        };
+
+    private:
+        void _send(std::uint32_t slot);
+        void _notify(nstd::observer_ptr<Engine::IEdict> player,
+                     const WireQuery &query,
+                     const std::vector<Waiter> &waiters,
+                     std::string_view value,
+                     CvarQueryStatus status);
+
+    private:
+        nstd::observer_ptr<Engine::ILibrary> m_engine;
+        std::vector<Slot> m_slots;
+        std::unordered_map<CvarQueryId::BaseType, std::uint32_t> m_slotById;
+        CvarQueryId::BaseType m_lastId = INVALID_CVAR_QUERY;
+        std::uint32_t m_lastRequestID = 0;
+        float m_lastTime = 0.0f;
+    };
+} // namespace Anubis
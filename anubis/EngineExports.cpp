@@ -88,6 +88,9 @@ namespace
             serverPrint("   gpl              - display license\n");
             serverPrint("   version          - display anubis version info\n");
             serverPrint("   list             - list currently loaded extensions\n");
+            serverPrint("   chatfilter       - reload chat filter patterns or show their hits\n");
+            serverPrint("   stats            - display command and connection limiter counters\n");
+            serverPrint("   bans             - display, reload or save ban index\n");
         };
 
         if (engLib->cmdArgc(Anubis::FuncCallType::Direct) == 1)
@@ -140,6 +143,47 @@ namespace
         {
             Anubis::gAnubisApi->printPluginList();
         }
+        else if (cmd == "stats")
+        {
+            Anubis::gAnubisApi->printStats();
+        }
+        else if (cmd == "bans")
+        {
+            std::string_view subCmd = engLib->cmdArgv(2, Anubis::FuncCallType::Direct);
+
+            if (subCmd == "reload")
+            {
+                Anubis::gAnubisApi->loadBanIndex();
+            }
+            else if (subCmd == "save")
+            {
+                if (!Anubis::gAnubisApi->getBanIndex()->save())
+                {
+                    serverPrint("Cannot save ban index\n");
+                }
+            }
+            else
+            {
+                Anubis::gAnubisApi->printBanIndexInfo();
+            }
+        }
+        else if (cmd == "chatfilter")
+        {
+            std::string_view subCmd = engLib->cmdArgv(2, Anubis::FuncCallType::Direct);
+
+            if (subCmd == "reload")
+            {
+                Anubis::gAnubisApi->loadChatFilter();
+            }
+            else if (subCmd == "stats")
+            {
+                Anubis::gAnubisApi->printChatFilterStats();
+            }
+            else
+            {
+                serverPrint("Usage: anubis chatfilter <reload|stats>\n");
+            }
+        }
         else
         {
             printUsage();
@@ -188,6 +232,8 @@ extern "C" ANUBIS_API void
     printStartUpMsg(pengfuncsFromEngine);
 
     Anubis::gAnubisApi->initLogger();
+    Anubis::gAnubisApi->loadChatFilter();
+    Anubis::gAnubisApi->loadBanIndex();
 
     try
     {
@@ -0,0 +1,220 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "EntityPools.hpp"
+
+#include <engine/ILibrary.hpp>
+#include <engine/IEdict.hpp>
+#include <engine/IHooks.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace Anubis
+{
+    EntityPools::EntityPools(nstd::observer_ptr<Engine::ILibrary> engine)
+        : m_engine(engine),
+          m_inUse(Engine::EDICTS_LIMIT)
+    {
+        // Entity removed while in use is not counted anymore
+        m_engine->getHooks()->edFree()->registerHook(
+            [this](const std::unique_ptr<Engine::IEdFreeHook> &hook, nstd::observer_ptr<Engine::IEdict> edict)
+            {
+                hook->callNext(edict);
+
+                if (InUse &inUse = m_inUse[edict->getIndex()]; edict->isFree() && inUse.pool)
+                {
+                    inUse.pool->stats.inUse--;
+                    inUse = {};
+                }
+            },
+            HookPriority::Uninterruptable);
+    }
+
+    bool EntityPools::createPool(std::string_view className, std::size_t capacity)
+    {
+        if (className.empty())
+        {
+            return false;
+        }
+
+        auto [iter, inserted] = m_pools.try_emplace(std::string(className));
+        Pool &pool = iter->second;
+        if (inserted)
+        {
+            pool.className = className;
+        }
+
+        pool.stats.capacity = capacity;
+        if (m_mapRunning)
+        {
+            _fill(pool);
+        }
+
+        return inserted;
+    }
+
+    nstd::observer_ptr<Engine::IEdict> EntityPools::acquire(std::string_view className)
+    {
+        auto iter = m_pools.find(className);
+        if (iter == m_pools.end() || !m_mapRunning)
+        {
+            return {};
+        }
+
+        Pool &pool = iter->second;
+        nstd::observer_ptr<Engine::IEdict> edict;
+
+        // Entries removed behind our back are skipped
+        while (!edict && !pool.entries.empty())
+        {
+            Entry entry = pool.entries.back();
+            pool.entries.pop_back();
+
+            if (!entry.edict->isFree() && entry.edict->getSerialNumber() == entry.serialNumber)
+            {
+                edict = entry.edict;
+                pool.stats.reused++;
+            }
+        }
+
+        if (!edict)
+        {
+            if (edict = m_engine->createNamedEntity(pool.name, FuncCallType::Direct); !edict)
+            {
+                return {};
+            }
+            pool.stats.created++;
+        }
+
+        using Effects = Engine::IEdict::Effects;
+        edict->setEffects(static_cast<Effects>(static_cast<std::underlying_type_t<Effects>>(edict->getEffects()) &
+                                               ~static_cast<std::underlying_type_t<Effects>>(Effects::NoDraw)));
+
+        m_inUse[edict->getIndex()] = {&pool, edict->getSerialNumber()};
+        pool.stats.available = pool.entries.size();
+        pool.stats.inUse++;
+        pool.stats.peakInUse = std::max(pool.stats.peakInUse, pool.stats.inUse);
+
+        return edict;
+    }
+
+    bool EntityPools::release(nstd::observer_ptr<Engine::IEdict> entity)
+    {
+        if (!entity || entity->getIndex() >= m_inUse.size())
+        {
+            return false;
+        }
+
+        InUse &inUse = m_inUse[entity->getIndex()];
+        if (!inUse.pool || entity->isFree() || entity->getSerialNumber() != inUse.serialNumber)
+        {
+            return false;
+        }
+
+        Pool &pool = *inUse.pool;
+        inUse = {};
+        pool.stats.inUse--;
+
+        if (pool.entries.size() >= pool.stats.capacity)
+        {
+            m_engine->removeEntity(entity, FuncCallType::Direct);
+            return true;
+        }
+
+        _hide(entity);
+        pool.entries.push_back({entity, entity->getSerialNumber()});
+        pool.stats.available = pool.entries.size();
+
+        return true;
+    }
+
+    std::optional<EntityPoolStats> EntityPools::getStats(std::string_view className) const
+    {
+        if (auto iter = m_pools.find(className); iter != m_pools.end())
+        {
+            return iter->second.stats;
+        }
+
+        return std::nullopt;
+    }
+
+    void EntityPools::fill()
+    {
+        m_mapRunning = true;
+
+        for (auto &[className, pool] : m_pools)
+        {
+            // Strings are freed on map change
+            pool.name = m_engine->allocString(className, FuncCallType::Direct);
+            _fill(pool);
+        }
+    }
+
+    void EntityPools::drain()
+    {
+        m_mapRunning = false;
+
+        for (auto &[className, pool] : m_pools)
+        {
+            pool.entries.clear();
+            pool.stats = {pool.stats.capacity, 0, 0, 0, 0, 0};
+        }
+
+        std::fill(m_inUse.begin(), m_inUse.end(), InUse {});
+    }
+
+    void EntityPools::_fill(Pool &pool)
+    {
+        if (!pool.name)
+        {
+            pool.name = m_engine->allocString(pool.className, FuncCallType::Direct);
+        }
+
+        while (pool.entries.size() < pool.stats.capacity)
+        {
+            auto edict = m_engine->createNamedEntity(pool.name, FuncCallType::Direct);
+            if (!edict)
+            {
+                break;
+            }
+
+            _hide(edict);
+            pool.entries.push_back({edict, edict->getSerialNumber()});
+        }
+
+        pool.stats.available = pool.entries.size();
+    }
+
+    void EntityPools::_hide(nstd::observer_ptr<Engine::IEdict> edict)
+    {
+        using Effects = Engine::IEdict::Effects;
+
+        edict->setEffects(static_cast<Effects>(static_cast<std::underlying_type_t<Effects>>(edict->getEffects()) |
+                                               static_cast<std::underlying_type_t<Effects>>(Effects::NoDraw)));
+        edict->setSolidType(Engine::IEdict::SolidType::Not);
+        edict->setMoveType(Engine::IEdict::MoveType::None);
+        edict->setVecProperty(Engine::IEdict::VecProperty::Velocity, {0.0f, 0.0f, 0.0f});
+        edict->setVecProperty(Engine::IEdict::VecProperty::AVelocity, {0.0f, 0.0f, 0.0f});
+        edict->setFlProperty(Engine::IEdict::FlProperty::NextThink, 0.0f);
+
+        // Relinks the entity as not solid
+        m_engine->setOrigin(edict, edict->getVecProperty(Engine::IEdict::VecProperty::Origin), FuncCallType::Direct);
+    }
+} // namespace Anubis
@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <IEntityPools.hpp>
+#include <engine/Common.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Anubis
+{
+    namespace Engine
+    {
+        class ILibrary;
+    }
+
+    class EntityPools final : public IEntityPools
+    {
+    public:
+        explicit EntityPools(nstd::observer_ptr<Engine::ILibrary> engine);
+        ~EntityPools() final = default;
+
+        bool createPool(std::string_view className, std::size_t capacity) final;
+        nstd::observer_ptr<Engine::IEdict> acquire(std::string_view className) final;
+        bool release(nstd::observer_ptr<Engine::IEdict> entity) final;
+        [[nodiscard]] std::optional<EntityPoolStats> getStats(std::string_view className) const final;
+
+        /* Called on map start and end, the engine frees all entities on map change */
+        void fill();
+        void drain();
+
+    private:
+        struct Entry
+        {
+            nstd::observer_ptr<Engine::IEdict> edict;
+            std::uint32_t serialNumber;
+        };
+
+        struct Pool
+        {
+            std::string className;
+            Engine::StringOffset name;
+            std::vector<Entry> entries; // hidden, waiting to be acquired
+            EntityPoolStats stats;
+        };
+
+        struct InUse
+        {
+            Pool *pool = nullptr;
+            std::uint32_t serialNumber = 0;
+        };
+
+    private:
+        void _fill(Pool &pool);
+        void _hide(nstd::observer_ptr<Engine::IEdict> edict);
+
+    private:
+        nstd::observer_ptr<Engine::ILibrary> m_engine;
+        std::map<std::string, Pool, std::less<>> m_pools;
+        std::vector<InUse> m_inUse; // indexed by edict index
+        bool m_mapRunning = false;
+    };
+} // namespace Anubis
@@ -0,0 +1,335 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "EntityWatcher.hpp"
+
+#include <engine/ILibrary.hpp>
+#include <engine/IEdict.hpp>
+#include <engine/IHooks.hpp>
+
+#include <extdll.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Anubis
+{
+    namespace
+    {
+        struct FieldInfo
+        {
+            std::size_t offset;
+            bool isFloat;
+        };
+
+        constexpr std::array<FieldInfo, EntityWatcher::FIELDS_NUM> fieldsInfo = {{
+            {offsetof(entvars_t, health), true},
+            {offsetof(entvars_t, max_health), true},
+            {offsetof(entvars_t, armorvalue), true},
+            {offsetof(entvars_t, frags), true},
+            {offsetof(entvars_t, takedamage), true},
+            {offsetof(entvars_t, renderamt), true},
+            {offsetof(entvars_t, team), false},
+            {offsetof(entvars_t, flags), false},
+            {offsetof(entvars_t, deadflag), false},
+            {offsetof(entvars_t, weapons), false},
+            {offsetof(entvars_t, modelindex), false},
+            {offsetof(entvars_t, model), false},
+            {offsetof(entvars_t, weaponmodel), false},
+            {offsetof(entvars_t, movetype), false},
+            {offsetof(entvars_t, solid), false},
+            {offsetof(entvars_t, effects), false},
+            {offsetof(entvars_t, rendermode), false},
+        }};
+
+        EntityFieldValue toFieldValue(EntityField field, std::uint32_t value)
+        {
+            if (fieldsInfo[static_cast<std::size_t>(field)].isFloat)
+            {
+                float floatValue;
+                std::memcpy(&floatValue, &value, sizeof(floatValue));
+                return floatValue;
+            }
+
+            return static_cast<std::int32_t>(value);
+        }
+    } // namespace
+
+    EntityWatcher::EntityWatcher(nstd::observer_ptr<Engine::ILibrary> engine)
+        : m_engine(engine),
+          m_edicts(Engine::EDICTS_LIMIT),
+          m_present(Engine::EDICTS_LIMIT),
+          m_newPresent(Engine::EDICTS_LIMIT),
+          m_changed(Engine::EDICTS_LIMIT)
+    {
+        // Entity created in place of the removed one is compared from the next frame on
+        m_engine->getHooks()->edFree()->registerHook(
+            [this](const std::unique_ptr<Engine::IEdFreeHook> &hook, nstd::observer_ptr<Engine::IEdict> edict)
+            {
+                hook->callNext(edict);
+
+                if (edict->isFree())
+                {
+                    m_present[edict->getIndex()] = 0;
+                }
+            },
+            HookPriority::Uninterruptable);
+    }
+
+    EntityWatchId EntityWatcher::watch(EntityField field,
+                                       EntityWatchScope scope,
+                                       std::string_view className,
+                                       EntityChangeCallback callback)
+    {
+        // Skip the invalid handle on wrap around
+        if (++m_lastId == INVALID_ENTITY_WATCH)
+        {
+            ++m_lastId;
+        }
+
+        m_watches.push_back(std::make_unique<Watch>(
+            Watch {m_lastId, field, scope, std::string(className), std::move(callback), {}, false}));
+
+        if (Field &watchedField = m_fields[static_cast<std::size_t>(field)]; !watchedField.watchesNum++)
+        {
+            watchedField.values.resize(Engine::EDICTS_LIMIT);
+            watchedField.newValues.resize(Engine::EDICTS_LIMIT);
+            watchedField.primed = false;
+            m_activeFields.push_back(field);
+        }
+
+        m_rangesChanged = true;
+
+        return EntityWatchId(m_lastId);
+    }
+
+    bool EntityWatcher::unwatch(EntityWatchId id)
+    {
+        auto it = std::find_if(m_watches.begin(), m_watches.end(),
+                               [id](const std::unique_ptr<Watch> &watch)
+                               {
+                                   return watch->id == id.value && !watch->removed;
+                               });
+
+        if (it == m_watches.end())
+        {
+            return false;
+        }
+
+        EntityField field = (*it)->field;
+
+        // Callback may be running, watches are erased once all of them are called
+        if (m_dispatching)
+        {
+            (*it)->removed = true;
+        }
+        else
+        {
+            m_watches.erase(it);
+        }
+
+        if (Field &watchedField = m_fields[static_cast<std::size_t>(field)]; !--watchedField.watchesNum)
+        {
+            watchedField = {};
+            m_activeFields.erase(std::find(m_activeFields.begin(), m_activeFields.end(), field));
+        }
+
+        m_rangesChanged = true;
+
+        return true;
+    }
+
+    void EntityWatcher::update()
+    {
+        if (m_activeFields.empty())
+        {
+            return;
+        }
+
+        if (std::uint32_t maxClients = m_engine->getMaxClients(); m_rangesChanged || maxClients != m_maxClients)
+        {
+            m_maxClients = maxClients;
+            _updateRanges();
+        }
+
+        // Values are gathered from entvars into one array per field, so the comparison runs over contiguous memory
+        std::fill(m_newPresent.begin(), m_newPresent.end(), 0);
+        for (nstd::observer_ptr<Engine::IEdict> edict : m_engine->getEdictsInUse())
+        {
+            std::uint32_t index = edict->getIndex();
+            if (index >= m_scanLast)
+            {
+                break;
+            }
+
+            const auto *vars = reinterpret_cast<const std::byte *>(&static_cast<edict_t *>(*edict)->v);
+            m_newPresent[index] = ~0u;
+            m_edicts[index] = edict;
+
+            for (EntityField field : m_activeFields)
+            {
+                auto fieldIndex = static_cast<std::size_t>(field);
+                if (Field &watchedField = m_fields[fieldIndex];
+                    index >= watchedField.first && index < watchedField.last)
+                {
+                    std::memcpy(&watchedField.newValues[index], vars + fieldsInfo[fieldIndex].offset,
+                                sizeof(std::uint32_t));
+                }
+            }
+        }
+
+        for (EntityField field : m_activeFields)
+        {
+            _findChanges(field);
+        }
+
+        m_present.swap(m_newPresent);
+
+        m_dispatching = true;
+        for (std::size_t i = 0; i < m_watches.size(); i++)
+        {
+            Watch *watch = m_watches[i].get();
+            if (!watch->changes.empty() && !watch->removed)
+            {
+                watch->callback(watch->changes);
+            }
+
+            watch->changes.clear();
+        }
+        m_dispatching = false;
+
+        m_watches.erase(std::remove_if(m_watches.begin(), m_watches.end(),
+                                       [](const std::unique_ptr<Watch> &watch)
+                                       {
+                                           return watch->removed;
+                                       }),
+                        m_watches.end());
+    }
+
+    void EntityWatcher::clear()
+    {
+        std::fill(m_present.begin(), m_present.end(), 0);
+
+        for (Field &field : m_fields)
+        {
+            field.primed = false;
+        }
+    }
+
+    void EntityWatcher::_updateRanges()
+    {
+        m_rangesChanged = false;
+        m_scanLast = 0;
+
+        for (EntityField field : m_activeFields)
+        {
+            std::uint32_t first = Engine::EDICTS_LIMIT;
+            std::uint32_t last = 0;
+
+            for (const auto &watch : m_watches)
+            {
+                if (watch->field != field || watch->removed)
+                {
+                    continue;
+                }
+
+                first = std::min(first, watch->scope == EntityWatchScope::NonPlayers ? m_maxClients + 1 : 1);
+                last = std::max(last, watch->scope == EntityWatchScope::Players ? m_maxClients + 1
+                                                                                : Engine::EDICTS_LIMIT);
+            }
+
+            // Values of edicts added to the range are not known yet
+            Field &watchedField = m_fields[static_cast<std::size_t>(field)];
+            if (first < watchedField.first || last > watchedField.last)
+            {
+                watchedField.primed = false;
+            }
+
+            watchedField.first = first;
+            watchedField.last = std::max(first, last);
+            m_scanLast = std::max(m_scanLast, watchedField.last);
+        }
+    }
+
+    void EntityWatcher::_findChanges(EntityField field)
+    {
+        Field &watchedField = m_fields[static_cast<std::size_t>(field)];
+        if (!watchedField.primed)
+        {
+            watchedField.values.swap(watchedField.newValues);
+            watchedField.primed = true;
+            return;
+        }
+
+        const std::uint32_t *values = watchedField.values.data();
+        const std::uint32_t *newValues = watchedField.newValues.data();
+        const std::uint32_t *present = m_present.data();
+        const std::uint32_t *newPresent = m_newPresent.data();
+        std::uint32_t *changed = m_changed.data();
+        std::uint32_t first = watchedField.first;
+        std::uint32_t last = watchedField.last;
+
+        // Branchless, so the compiler can vectorize it
+        std::uint32_t changedNum = 0;
+        for (std::uint32_t i = first; i < last; i++)
+        {
+            changed[i] = (values[i] != newValues[i] ? ~0u : 0u) & present[i] & newPresent[i];
+            changedNum += changed[i] & 1u;
+        }
+
+        for (std::uint32_t i = first; i < last && changedNum; i++)
+        {
+            if (!changed[i])
+            {
+                continue;
+            }
+
+            changedNum--;
+            for (const auto &watch : m_watches)
+            {
+                if (watch->field == field && !watch->removed && _matches(*watch, i))
+                {
+                    watch->changes.push_back({m_edicts[i], field, toFieldValue(field, values[i]),
+                                              toFieldValue(field, newValues[i])});
+                }
+            }
+        }
+
+        watchedField.values.swap(watchedField.newValues);
+    }
+
+    bool EntityWatcher::_matches(const Watch &watch, std::uint32_t index) const
+    {
+        bool isPlayer = index <= m_maxClients;
+        if ((watch.scope == EntityWatchScope::Players && !isPlayer) ||
+            (watch.scope == EntityWatchScope::NonPlayers && isPlayer))
+        {
+            return false;
+        }
+
+        if (watch.className.empty())
+        {
+            return true;
+        }
+
+        auto className = m_edicts[index]->getStrProperty(Engine::IEdict::StrProperty::ClassName);
+
+        return m_engine->getString(className, FuncCallType::Direct) == watch.className;
+    }
+} // namespace Anubis
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <IEntityWatcher.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Anubis
+{
+    namespace Engine
+    {
+        class ILibrary;
+    }
+
+    class EntityWatcher final : public IEntityWatcher
+    {
+    public:
+        static constexpr std::size_t FIELDS_NUM = static_cast<std::size_t>(EntityField::RenderMode) + 1;
+
+    public:
+        explicit EntityWatcher(nstd::observer_ptr<Engine::ILibrary> engine);
+        ~EntityWatcher() final = default;
+
+        EntityWatchId watch(EntityField field,
+                            EntityWatchScope scope,
+                            std::string_view className,
+                            EntityChangeCallback callback) final;
+        bool unwatch(EntityWatchId id) final;
+
+        /* Compares watched fields and calls callbacks of watches with changes */
+        void update();
+        void clear();
+
+    private:
+        struct Watch
+        {
+            EntityWatchId::BaseType id;
+            EntityField field;
+            EntityWatchScope scope;
+            std::string className;
+            EntityChangeCallback callback;
+            std::vector<EntityChange> changes;
+            bool removed = false;
+        };
+
+        /* Values of the field in structure of arrays indexed by edict, compared in a single pass */
+        struct Field
+        {
+            std::vector<std::uint32_t> values;
+            std::vector<std::uint32_t> newValues;
+            std::uint32_t first = 0;    // range of compared edicts
+            std::uint32_t last = 0;
+            std::size_t watchesNum = 0;
+            bool primed = false; // values hold the previous frame
+        };
+
+    private:
+        void _updateRanges();
+        void _findChanges(EntityField field);
+        [[nodiscard]] bool _matches(const Watch &watch, std::uint32_t index) const;
+
+    private:
+        nstd::observer_ptr<Engine::ILibrary> m_engine;
+        std::vector<std::unique_ptr<Watch>> m_watches; // pointers stay valid while callbacks add watches
+        std::array<Field, FIELDS_NUM> m_fields;
+        std::vector<EntityField> m_activeFields;
+        std::vector<nstd::observer_ptr<Engine::IEdict>> m_edicts;
+        std::vector<std::uint32_t> m_present; // all bits set for edicts in use in the previous frame
+        std::vector<std::uint32_t> m_newPresent;
+        std::vector<std::uint32_t> m_changed;
+        EntityWatchId::BaseType m_lastId = INVALID_ENTITY_WATCH;
+        std::uint32_t m_scanLast = 0;
+        std::uint32_t m_maxClients = 0;
+        bool m_rangesChanged = false;
+        bool m_dispatching = false;
+    };
+} // namespace Anubis
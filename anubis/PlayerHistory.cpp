@@ -0,0 +1,184 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "PlayerHistory.hpp"
+
+#include <engine/ILibrary.hpp>
+#include <engine/IEdict.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace Anubis
+{
+    namespace
+    {
+        constexpr float NO_RECORD_TIME = -std::numeric_limits<float>::max();
+
+        bool isPlayer(nstd::observer_ptr<Engine::IEdict> edict)
+        {
+            using Flag = Engine::IEdict::Flag;
+
+            return edict && !edict->isFree() &&
+                   (static_cast<std::underlying_type_t<Flag>>(edict->getFlags()) &
+                    static_cast<std::underlying_type_t<Flag>>(Flag::Client));
+        }
+    } // namespace
+
+    PlayerHistory::PlayerHistory(nstd::observer_ptr<Engine::ILibrary> engine, std::uint32_t slotsNum)
+        : m_engine(engine),
+          m_rings(slotsNum + 1),
+          m_times(m_rings.size() * RECORDS_NUM),
+          m_origins(m_rings.size() * RECORDS_NUM),
+          m_angles(m_rings.size() * RECORDS_NUM),
+          m_mins(m_rings.size() * RECORDS_NUM),
+          m_maxs(m_rings.size() * RECORDS_NUM),
+          m_lastTime(NO_RECORD_TIME)
+    {
+    }
+
+    std::optional<PlayerSnapshot> PlayerHistory::getSnapshot(nstd::observer_ptr<Engine::IEdict> player,
+                                                             float time) const
+    {
+        if (!player || !player->getIndex() || player->getIndex() >= m_rings.size())
+        {
+            return std::nullopt;
+        }
+
+        return _lookup(player->getIndex(), time);
+    }
+
+    std::size_t PlayerHistory::rewind(float time, PlayerSnapshot *snapshots, std::size_t num) const
+    {
+        std::size_t filled = 0;
+        for (std::uint32_t slot = 1; slot < m_rings.size() && filled < num; slot++)
+        {
+            if (auto snapshot = _lookup(slot, time); snapshot)
+            {
+                snapshots[filled++] = *snapshot;
+            }
+        }
+
+        return filled;
+    }
+
+    void PlayerHistory::record(float time)
+    {
+        // Time starts over on map change
+        if (time < m_lastTime)
+        {
+            clear();
+        }
+
+        if (time - m_lastTime < RECORD_INTERVAL)
+        {
+            return;
+        }
+
+        m_lastTime = time;
+
+        auto slotsNum = std::min(static_cast<std::size_t>(m_engine->getMaxClients()) + 1, m_rings.size());
+        for (std::uint32_t slot = 1; slot < slotsNum; slot++)
+        {
+            Ring &ring = m_rings[slot];
+            auto edict = m_engine->getEdict(slot, FuncCallType::Direct);
+            if (!isPlayer(edict))
+            {
+                ring = {};
+                continue;
+            }
+
+            std::size_t index = slot * RECORDS_NUM + ring.next;
+            m_times[index] = time;
+            m_origins[index] = edict->getVecProperty(Engine::IEdict::VecProperty::Origin);
+            m_angles[index] = edict->getVecProperty(Engine::IEdict::VecProperty::Angles);
+            m_mins[index] = edict->getVecProperty(Engine::IEdict::VecProperty::Mins);
+            m_maxs[index] = edict->getVecProperty(Engine::IEdict::VecProperty::Maxs);
+
+            ring.next = (ring.next + 1) % RECORDS_NUM;
+            ring.size = std::min(ring.size + 1, RECORDS_NUM);
+        }
+    }
+
+    void PlayerHistory::clear()
+    {
+        std::fill(m_rings.begin(), m_rings.end(), Ring {});
+        m_lastTime = NO_RECORD_TIME;
+    }
+
+    std::size_t PlayerHistory::_at(std::uint32_t slot, std::size_t age) const
+    {
+        return slot * RECORDS_NUM + (m_rings[slot].next + RECORDS_NUM - 1 - age) % RECORDS_NUM;
+    }
+
+    std::optional<PlayerSnapshot> PlayerHistory::_lookup(std::uint32_t slot, float time) const
+    {
+        const Ring &ring = m_rings[slot];
+        if (!ring.size || time < m_times[_at(slot, ring.size - 1)])
+        {
+            return std::nullopt;
+        }
+
+        std::size_t newest = _at(slot, 0);
+        if (time >= m_times[newest])
+        {
+            return PlayerSnapshot {slot,           m_times[newest], m_origins[newest],
+                                   m_angles[newest], m_mins[newest],  m_maxs[newest]};
+        }
+
+        // Records get older with the age, find the newest one which is not later than the time
+        std::size_t lo = 1;
+        std::size_t hi = ring.size - 1;
+        while (lo < hi)
+        {
+            std::size_t mid = (lo + hi) / 2;
+            if (m_times[_at(slot, mid)] <= time)
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+
+        std::size_t from = _at(slot, lo);
+        std::size_t to = _at(slot, lo - 1);
+        float fraction = (time - m_times[from]) / (m_times[to] - m_times[from]);
+
+        PlayerSnapshot snapshot {slot, time, {}, {}, {}, {}};
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            snapshot.origin[i] = m_origins[from][i] + (m_origins[to][i] - m_origins[from][i]) * fraction;
+
+            // Turn the shorter way when the angle wraps around
+            snapshot.angles[i] =
+                m_angles[from][i] + std::remainder(m_angles[to][i] - m_angles[from][i], 360.0f) * fraction;
+        }
+
+        // Bounds change at once, e.g. when ducking
+        std::size_t bounds = fraction < 0.5f ? from : to;
+        snapshot.mins = m_mins[bounds];
+        snapshot.maxs = m_maxs[bounds];
+
+        return snapshot;
+    }
+} // namespace Anubis
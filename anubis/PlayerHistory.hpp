@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <IPlayerHistory.hpp>
+
+#include <vector>
+
+namespace Anubis
+{
+    namespace Engine
+    {
+        class ILibrary;
+    }
+
+    class PlayerHistory final : public IPlayerHistory
+    {
+    public:
+        PlayerHistory(nstd::observer_ptr<Engine::ILibrary> engine, std::uint32_t slotsNum);
+        ~PlayerHistory() final = default;
+
+        [[nodiscard]] std::optional<PlayerSnapshot> getSnapshot(nstd::observer_ptr<Engine::IEdict> player,
+                                                                float time) const final;
+        std::size_t rewind(float time, PlayerSnapshot *snapshots, std::size_t num) const final;
+
+        /* Records positions of players, called after StartFrame */
+        void record(float time);
+        void clear();
+
+    private:
+        using Vector = std::array<float, 3>;
+
+        struct Ring
+        {
+            std::size_t next = 0;
+            std::size_t size = 0;
+        };
+
+    private:
+        [[nodiscard]] std::size_t _at(std::uint32_t slot, std::size_t age) const;
+        [[nodiscard]] std::optional<PlayerSnapshot> _lookup(std::uint32_t slot, float time) const;
+
+    private:
+        nstd::observer_ptr<Engine::ILibrary> m_engine;
+        std::vector<Ring> m_rings; // indexed by edict index, 0 is unused
+
+        /* Records of the slot occupy RECORDS_NUM entries starting at slot * RECORDS_NUM */
+        std::vector<float> m_times;
+        std::vector<Vector> m_origins;
+        std::vector<Vector> m_angles;
+        std::vector<Vector> m_mins;
+        std::vector<Vector> m_maxs;
+        float m_lastTime = 0.0f;
+    };
+} // namespace Anubis
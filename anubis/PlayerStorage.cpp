@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "PlayerStorage.hpp"
+
+#include <algorithm>
+
+namespace Anubis
+{
+    PlayerStorage::PlayerStorage(std::uint32_t maxClientsLimit) : m_slotsNum(maxClientsLimit + 1) {}
+
+    PlayerStorage::~PlayerStorage()
+    {
+        // plugins are unloaded at this point, destructors of the elements are no longer reachable
+        for (const auto &column : m_columns)
+        {
+            ::operator delete(column.data, std::align_val_t(column.alignment));
+        }
+    }
+
+    void *PlayerStorage::allocColumn(std::size_t size, std::size_t alignment, ElementCtor ctor, ElementDtor dtor)
+    {
+        alignment = std::max(alignment, CACHE_LINE_SIZE);
+
+        auto data = static_cast<std::byte *>(::operator new(size * m_slotsNum, std::align_val_t(alignment)));
+        for (std::uint32_t i = 0; i < m_slotsNum; i++)
+        {
+            ctor(data + i * size);
+        }
+
+        m_columns.push_back({data, size, alignment, ctor, dtor});
+        return data;
+    }
+
+    void PlayerStorage::freeColumn(void *column)
+    {
+        auto it = std::find_if(m_columns.begin(), m_columns.end(),
+                               [column](const Column &col)
+                               {
+                                   return col.data == column;
+                               });
+
+        if (it == m_columns.end())
+        {
+            return;
+        }
+
+        for (std::uint32_t i = 0; i < m_slotsNum; i++)
+        {
+            it->dtor(it->data + i * it->size);
+        }
+
+        ::operator delete(it->data, std::align_val_t(it->alignment));
+        m_columns.erase(it);
+    }
+
+    std::uint32_t PlayerStorage::getSlotsNum() const
+    {
+        return m_slotsNum;
+    }
+
+    void PlayerStorage::resetSlot(std::uint32_t index)
+    {
+        if (!index || index >= m_slotsNum)
+        {
+            return;
+        }
+
+        for (const auto &column : m_columns)
+        {
+            std::byte *element = column.data + index * column.size;
+            column.dtor(element);
+            column.ctor(element);
+        }
+    }
+} // namespace Anubis
@@ -0,0 +1,59 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <IPlayerStorage.hpp>
+
+#include <vector>
+
+namespace Anubis
+{
+    class PlayerStorage final : public IPlayerStorage
+    {
+    public:
+        static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    public:
+        explicit PlayerStorage(std::uint32_t maxClientsLimit);
+        PlayerStorage(const PlayerStorage &other) = delete;
+        PlayerStorage(PlayerStorage &&other) = delete;
+        ~PlayerStorage() final;
+
+        void *allocColumn(std::size_t size, std::size_t alignment, ElementCtor ctor, ElementDtor dtor) final;
+        void freeColumn(void *column) final;
+        [[nodiscard]] std::uint32_t getSlotsNum() const final;
+
+        void resetSlot(std::uint32_t index);
+
+    private:
+        struct Column
+        {
+            std::byte *data;
+            std::size_t size;
+            std::size_t alignment;
+            ElementCtor ctor;
+            ElementDtor dtor;
+        };
+
+    private:
+        std::uint32_t m_slotsNum;
+        std::vector<Column> m_columns;
+    };
+} // namespace Anubis
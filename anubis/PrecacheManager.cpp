@@ -0,0 +1,195 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "PrecacheManager.hpp"
+
+#include <engine/ILibrary.hpp>
+
+#include <fstream>
+
+namespace Anubis
+{
+    namespace
+    {
+        constexpr std::array<std::string_view, 3> typeNames = {"model", "sound", "generic"};
+    }
+
+    PrecacheManager::PrecacheManager(PrecacheSettings settings,
+                                     std::filesystem::path manifestDir,
+                                     const std::unique_ptr<Logger> &logger)
+        : m_settings(settings),
+          m_manifestDir(std::move(manifestDir)),
+          m_logger(logger)
+    {
+    }
+
+    std::optional<Engine::PrecacheId> PrecacheManager::find(PrecacheType type, std::string_view name) const
+    {
+        const auto &indexes = m_tables[static_cast<std::size_t>(type)].indexes;
+
+        if (auto it = indexes.find(name); it != indexes.end())
+        {
+            return it->second;
+        }
+
+        return std::nullopt;
+    }
+
+    void PrecacheManager::add(PrecacheType type, std::string_view name, Engine::PrecacheId id)
+    {
+        auto &table = m_tables[static_cast<std::size_t>(type)];
+
+        if (table.indexes.find(name) != table.indexes.end())
+        {
+            return;
+        }
+
+        std::string_view storedName = table.names.emplace_back(name);
+        table.indexes.emplace(storedName, id);
+        if (!m_replaying)
+        {
+            table.requested.emplace(storedName);
+        }
+
+        // Engine precaches some resources on its own, so the highest index tells how many slots are used
+        table.usedNum = std::max(table.usedNum, static_cast<std::size_t>(id) + 1);
+
+        if (table.warned || table.usedNum + m_settings.warnFree < MAX_ENTRIES)
+        {
+            return;
+        }
+
+        table.warned = true;
+        m_logger->logMsg(LogLevel::Warning, LogDest::ConsoleFile, "{} of {} {} precache slots are used", table.usedNum,
+                         MAX_ENTRIES, typeNames[static_cast<std::size_t>(type)]);
+    }
+
+    void PrecacheManager::markRequested(PrecacheType type, std::string_view name)
+    {
+        auto &table = m_tables[static_cast<std::size_t>(type)];
+
+        if (m_replaying || table.requested.find(name) != table.requested.end())
+        {
+            return;
+        }
+
+        if (auto it = table.indexes.find(name); it != table.indexes.end())
+        {
+            table.requested.emplace(it->first);
+        }
+    }
+
+    std::size_t PrecacheManager::getUsedNum(PrecacheType type) const
+    {
+        return m_tables[static_cast<std::size_t>(type)].usedNum;
+    }
+
+    void PrecacheManager::precacheManifest(std::string_view mapName, nstd::observer_ptr<Engine::ILibrary> engine)
+    {
+        if (!m_settings.manifest)
+        {
+            return;
+        }
+
+        // Engine keeps the pointer to the name, it has to live as long as the map
+        auto persistName = [engine](std::string_view name)
+        {
+            return engine->getString(engine->allocString(name, FuncCallType::Direct), FuncCallType::Direct);
+        };
+
+        std::ifstream file(_getManifestPath(mapName));
+        std::string line;
+
+        // Resources which are no longer requested have to be left out of the next manifest
+        m_replaying = true;
+        while (std::getline(file, line))
+        {
+            std::string_view entry = line;
+            std::size_t spacePos = entry.find(' ');
+
+            if (spacePos == std::string_view::npos || spacePos + 1 == entry.size())
+            {
+                continue;
+            }
+
+            std::string_view typeName = entry.substr(0, spacePos);
+            std::string_view name = entry.substr(spacePos + 1);
+
+            if (typeName == typeNames[static_cast<std::size_t>(PrecacheType::Model)])
+            {
+                [[maybe_unused]] auto id = engine->precacheModel(persistName(name), FuncCallType::Direct);
+            }
+            else if (typeName == typeNames[static_cast<std::size_t>(PrecacheType::Sound)])
+            {
+                [[maybe_unused]] auto id = engine->precacheSound(persistName(name), FuncCallType::Direct);
+            }
+            else if (typeName == typeNames[static_cast<std::size_t>(PrecacheType::Generic)])
+            {
+                [[maybe_unused]] auto id = engine->precacheGeneric(persistName(name), FuncCallType::Direct);
+            }
+        }
+
+        m_replaying = false;
+    }
+
+    void PrecacheManager::endMap(std::string_view mapName)
+    {
+        if (m_settings.manifest && !mapName.empty())
+        {
+            _writeManifest(mapName);
+        }
+
+        for (auto &table : m_tables)
+        {
+            table = {};
+        }
+    }
+
+    std::filesystem::path PrecacheManager::_getManifestPath(std::string_view mapName) const
+    {
+        return m_manifestDir / std::string(mapName).append(".txt");
+    }
+
+    void PrecacheManager::_writeManifest(std::string_view mapName) const
+    {
+        std::error_code errorCode;
+        std::filesystem::create_directories(m_manifestDir, errorCode);
+
+        std::ofstream file(_getManifestPath(mapName), std::ios::trunc);
+        if (!file)
+        {
+            m_logger->logMsg(LogLevel::Error, LogDest::ConsoleFile, "Cannot write precache manifest of {}", mapName);
+            return;
+        }
+
+        for (std::size_t i = 0; i < m_tables.size(); i++)
+        {
+            const auto &table = m_tables[i];
+            for (const auto &name : table.names)
+            {
+                if (table.requested.find(name) == table.requested.end())
+                {
+                    continue;
+                }
+
+                file << typeNames[i] << ' ' << name << '\n';
+            }
+        }
+    }
+} // namespace Anubis
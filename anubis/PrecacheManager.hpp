@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "AnubisConfig.hpp"
+#include "Logger.hpp"
+
+#include <engine/Common.hpp>
+
+#include <array>
+#include <deque>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Anubis
+{
+    namespace Engine
+    {
+        class ILibrary;
+    }
+
+    enum class PrecacheType : std::uint8_t
+    {
+        Model = 0,
+        Sound,
+        Generic
+    };
+
+    /* Per-map cache of precached resources.
+     * Indexes are remembered by name, so repeated precaches and model index lookups do not scan engine tables. */
+    class PrecacheManager
+    {
+    public:
+        static constexpr std::size_t MAX_ENTRIES = 512;
+
+    public:
+        PrecacheManager(PrecacheSettings settings,
+                        std::filesystem::path manifestDir,
+                        const std::unique_ptr<Logger> &logger);
+
+        [[nodiscard]] std::optional<Engine::PrecacheId> find(PrecacheType type, std::string_view name) const;
+        void add(PrecacheType type, std::string_view name, Engine::PrecacheId id);
+
+        /* Marks the cached resource as precached again by the game or a plugin */
+        void markRequested(PrecacheType type, std::string_view name);
+        [[nodiscard]] std::size_t getUsedNum(PrecacheType type) const;
+
+        /* Precaches resources written by endMap() on the last load of the map */
+        void precacheManifest(std::string_view mapName, nstd::observer_ptr<Engine::ILibrary> engine);
+
+        /* Writes resources requested during the map to its manifest if enabled and forgets all indexes */
+        void endMap(std::string_view mapName);
+
+    private:
+        struct Table
+        {
+            std::deque<std::string> names; // in order of precaching, keys of indexes point here
+            std::unordered_map<std::string_view, Engine::PrecacheId> indexes;
+            std::unordered_set<std::string_view> requested; // not only replayed from the manifest
+            std::size_t usedNum = 0;
+            bool warned = false;
+        };
+
+    private:
+        [[nodiscard]] std::filesystem::path _getManifestPath(std::string_view mapName) const;
+        void _writeManifest(std::string_view mapName) const;
+
+    private:
+        PrecacheSettings m_settings;
+        std::filesystem::path m_manifestDir;
+        const std::unique_ptr<Logger> &m_logger;
+        std::array<Table, 3> m_tables;
+        bool m_replaying = false;
+    };
+} // namespace Anubis
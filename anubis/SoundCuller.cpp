@@ -0,0 +1,150 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "SoundCuller.hpp"
+
+#include <functional>
+
+namespace Anubis
+{
+    SoundCuller::SoundCuller(SoundSettings settings) : m_settings(settings) {}
+
+    bool SoundCuller::isEnabled() const
+    {
+        return m_settings.cull;
+    }
+
+    bool SoundCuller::startFrame(float time)
+    {
+        if (time == m_frameTime)
+        {
+            return false;
+        }
+
+        m_frameTime = time;
+        m_listeners.clear();
+        m_globalListener = false;
+        m_soundsNum = 0;
+        return true;
+    }
+
+    void SoundCuller::addListener(const std::array<float, 3> &origin)
+    {
+        m_listeners.push_back(origin);
+    }
+
+    void SoundCuller::addGlobalListener()
+    {
+        m_globalListener = true;
+    }
+
+    bool SoundCuller::cull(std::uint32_t entity,
+                           const std::array<float, 3> &origin,
+                           Engine::Channel channel,
+                           std::string_view sample,
+                           float volume,
+                           float attenuation,
+                           Engine::SoundFlags flags,
+                           Engine::Pitch pitch)
+    {
+        using Engine::SoundFlags;
+
+        // Sounds which stop or change the playing ones and static sounds sent to clients connecting later
+        constexpr auto keptFlags = static_cast<std::uint16_t>(SoundFlags::Stop) |
+                                   static_cast<std::uint16_t>(SoundFlags::Change_vol) |
+                                   static_cast<std::uint16_t>(SoundFlags::Change_pitch) |
+                                   static_cast<std::uint16_t>(SoundFlags::Spawning);
+
+        // Static channel and ambient sounds keep playing, listeners can walk up to them later
+        if (channel == Engine::Channel::Static || static_cast<std::uint16_t>(flags) & keptFlags)
+        {
+            m_stats.passed++;
+            return false;
+        }
+
+        if (!_isAudible(origin, attenuation))
+        {
+            m_stats.inaudible++;
+            return true;
+        }
+
+        std::size_t hash = std::hash<std::string_view>()(sample);
+        for (std::size_t i = 0; i < m_soundsNum; i++)
+        {
+            const Sound &sound = m_sounds[i];
+            if (sound.hash == hash && sound.entity == entity && sound.channel == channel && sound.volume == volume &&
+                sound.attenuation == attenuation && sound.flags == flags && sound.pitch == pitch &&
+                sound.sample == sample)
+            {
+                m_stats.duplicates++;
+                return true;
+            }
+        }
+
+        if (m_soundsNum == m_sounds.size())
+        {
+            m_sounds.emplace_back();
+        }
+
+        Sound &sound = m_sounds[m_soundsNum++];
+        sound.sample.assign(sample);
+        sound.hash = hash;
+        sound.entity = entity;
+        sound.channel = channel;
+        sound.volume = volume;
+        sound.attenuation = attenuation;
+        sound.flags = flags;
+        sound.pitch = pitch;
+
+        m_stats.passed++;
+        return false;
+    }
+
+    const SoundCuller::Stats &SoundCuller::getStats() const
+    {
+        return m_stats;
+    }
+
+    bool SoundCuller::_isAudible(const std::array<float, 3> &origin, float attenuation) const
+    {
+        // No listeners means no messages to save
+        if (attenuation <= 0.0f || m_globalListener || m_listeners.empty())
+        {
+            return true;
+        }
+
+        // Client fades the sound out linearly until dist * attenuation / NOMINAL_CLIP_DIST reaches 1
+        float range = NOMINAL_CLIP_DIST / attenuation + AUDIBLE_MARGIN;
+        float rangeSquared = range * range;
+
+        for (const auto &listener : m_listeners)
+        {
+            float dx = origin[0] - listener[0];
+            float dy = origin[1] - listener[1];
+            float dz = origin[2] - listener[2];
+
+            if (dx * dx + dy * dy + dz * dz < rangeSquared)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+} // namespace Anubis
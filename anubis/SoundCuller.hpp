@@ -0,0 +1,102 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "AnubisConfig.hpp"
+
+#include <engine/Common.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Anubis
+{
+    /* Drops emitted sounds which would not change what clients hear.
+     * Sound emitted again with the same arguments within a frame is a duplicate. Sound is inaudible when all
+     * listeners are beyond the distance at which its attenuation fades it out, the same way the client does it.
+     * Sounds on the static channel, ambient ones included, and sounds stopping or changing others are never dropped. */
+    class SoundCuller
+    {
+    public:
+        /* Same as sound_nominal_clip_dist in the client */
+        static constexpr float NOMINAL_CLIP_DIST = 1000.0f;
+
+        /* Listeners may move towards the sound while it plays */
+        static constexpr float AUDIBLE_MARGIN = 128.0f;
+
+        struct Stats
+        {
+            std::uint64_t passed = 0;
+            std::uint64_t duplicates = 0;
+            std::uint64_t inaudible = 0;
+        };
+
+    public:
+        explicit SoundCuller(SoundSettings settings);
+
+        [[nodiscard]] bool isEnabled() const;
+
+        /* Returns true if the frame has changed, listeners have to be added again then */
+        bool startFrame(float time);
+        void addListener(const std::array<float, 3> &origin);
+
+        /* Listener which hears sounds everywhere, e.g. HLTV proxy */
+        void addGlobalListener();
+
+        /* Returns true if the sound should not be sent */
+        bool cull(std::uint32_t entity,
+                  const std::array<float, 3> &origin,
+                  Engine::Channel channel,
+                  std::string_view sample,
+                  float volume,
+                  float attenuation,
+                  Engine::SoundFlags flags,
+                  Engine::Pitch pitch);
+
+        [[nodiscard]] const Stats &getStats() const;
+
+    private:
+        struct Sound
+        {
+            std::string sample;
+            std::size_t hash;
+            std::uint32_t entity;
+            Engine::Channel channel;
+            float volume;
+            float attenuation;
+            Engine::SoundFlags flags;
+            Engine::Pitch pitch;
+        };
+
+    private:
+        [[nodiscard]] bool _isAudible(const std::array<float, 3> &origin, float attenuation) const;
+
+    private:
+        SoundSettings m_settings;
+        float m_frameTime = -1.0f;
+        std::vector<std::array<float, 3>> m_listeners;
+        bool m_globalListener = false;
+        std::vector<Sound> m_sounds; // entries are reused between frames to keep their buffers
+        std::size_t m_soundsNum = 0;
+        Stats m_stats;
+    };
+} // namespace Anubis
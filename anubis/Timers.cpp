@@ -0,0 +1,308 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "Timers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Anubis
+{
+    Timers::Timers() : m_lastTime(std::numeric_limits<float>::max())
+    {
+        m_slots.fill(NIL);
+    }
+
+    TimerId Timers::schedule(float delay, TimerCallback callback, TimerFlags flags)
+    {
+        std::uint32_t index;
+        if (m_freeList != NIL)
+        {
+            index = m_freeList;
+            m_freeList = m_timers[index].next;
+        }
+        else
+        {
+            if (m_timers.size() > 0xFFFF)
+            {
+                return INVALID_TIMER;
+            }
+
+            index = static_cast<std::uint32_t>(m_timers.size());
+            m_timers.emplace_back();
+        }
+
+        auto ticks = static_cast<std::uint32_t>(std::ceil(std::max(delay, 0.0f) * TICKS_PER_SECOND));
+        ticks = std::clamp(ticks, 1u, MAX_TICKS);
+
+        Timer &timer = m_timers[index];
+        timer.callback = std::move(callback);
+        timer.interval = ticks;
+        timer.expires = m_now + ticks;
+        timer.flags = flags;
+        timer.next = NIL;
+        _link(index);
+        m_count++;
+
+        return TimerId(static_cast<std::uint32_t>(timer.generation) << 16 | index);
+    }
+
+    bool Timers::cancel(TimerId id)
+    {
+        std::uint32_t index = _decode(id);
+        if (index == NIL)
+        {
+            return false;
+        }
+
+        _unlink(index);
+
+        // callback is being executed, timer will be released once it returns
+        if (index == m_firing)
+        {
+            m_firingCancelled = true;
+            return true;
+        }
+
+        _release(index);
+        return true;
+    }
+
+    bool Timers::isPending(TimerId id) const
+    {
+        return _decode(id) != NIL;
+    }
+
+    float Timers::getTimeLeft(TimerId id) const
+    {
+        std::uint32_t index = _decode(id);
+        if (index == NIL)
+        {
+            return 0.0f;
+        }
+
+        return static_cast<float>(m_timers[index].expires - m_now) / TICKS_PER_SECOND;
+    }
+
+    std::size_t Timers::getCount() const
+    {
+        return m_count;
+    }
+
+    void Timers::advance(float time)
+    {
+        // global time starts again from the beginning on map change
+        if (time < m_lastTime)
+        {
+            m_baseTime = time;
+            m_baseTick = m_now;
+        }
+        m_lastTime = time;
+
+        auto target = m_baseTick + static_cast<std::uint32_t>((time - m_baseTime) * TICKS_PER_SECOND);
+
+        while (static_cast<std::int32_t>(target - m_currentTick) >= 0)
+        {
+            m_now = m_currentTick;
+
+            std::uint32_t slot = m_currentTick & (ROOT_SIZE - 1);
+            if (!slot)
+            {
+                for (std::uint32_t level = 1; level < LEVELS && !_cascade(level); level++)
+                {
+                }
+            }
+
+            while (m_slots[slot] != NIL)
+            {
+                _fire(m_slots[slot]);
+            }
+
+            m_currentTick++;
+        }
+
+        m_now = m_currentTick - 1;
+    }
+
+    void Timers::cancelMapScoped()
+    {
+        for (std::uint32_t index = 0; index < m_timers.size(); index++)
+        {
+            const Timer &timer = m_timers[index];
+            if (timer.pending && (timer.flags & TimerFlags::MapScoped) == TimerFlags::MapScoped)
+            {
+                cancel(TimerId(static_cast<std::uint32_t>(timer.generation) << 16 | index));
+            }
+        }
+    }
+
+    std::uint32_t Timers::_decode(TimerId id) const
+    {
+        std::uint32_t index = id & 0xFFFF;
+        if (index >= m_timers.size())
+        {
+            return NIL;
+        }
+
+        const Timer &timer = m_timers[index];
+        if (!timer.pending || timer.generation != (id >> 16))
+        {
+            return NIL;
+        }
+
+        return index;
+    }
+
+    std::uint32_t Timers::_slotFor(std::uint32_t expires) const
+    {
+        std::uint32_t delta = expires - m_currentTick;
+
+        // already expired, process it with the current tick
+        if (static_cast<std::int32_t>(delta) < 0)
+        {
+            return m_currentTick & (ROOT_SIZE - 1);
+        }
+
+        if (delta < ROOT_SIZE)
+        {
+            return expires & (ROOT_SIZE - 1);
+        }
+
+        std::uint32_t base = ROOT_SIZE;
+        std::uint32_t shift = ROOT_BITS;
+        for (std::uint32_t level = 1; level < LEVELS - 1; level++)
+        {
+            if (delta < (1u << (shift + LEVEL_BITS)))
+            {
+                break;
+            }
+            base += LEVEL_SIZE;
+            shift += LEVEL_BITS;
+        }
+
+        return base + ((expires >> shift) & (LEVEL_SIZE - 1));
+    }
+
+    void Timers::_link(std::uint32_t index)
+    {
+        Timer &timer = m_timers[index];
+        std::uint32_t slot = _slotFor(timer.expires);
+
+        timer.slot = slot;
+        timer.prev = NIL;
+        timer.next = m_slots[slot];
+        if (timer.next != NIL)
+        {
+            m_timers[timer.next].prev = index;
+        }
+        m_slots[slot] = index;
+        timer.pending = true;
+    }
+
+    void Timers::_unlink(std::uint32_t index)
+    {
+        Timer &timer = m_timers[index];
+        if (!timer.pending)
+        {
+            return;
+        }
+
+        if (timer.prev != NIL)
+        {
+            m_timers[timer.prev].next = timer.next;
+        }
+        else
+        {
+            m_slots[timer.slot] = timer.next;
+        }
+
+        if (timer.next != NIL)
+        {
+            m_timers[timer.next].prev = timer.prev;
+        }
+
+        timer.prev = timer.next = timer.slot = NIL;
+        timer.pending = false;
+    }
+
+    void Timers::_release(std::uint32_t index)
+    {
+        Timer &timer = m_timers[index];
+        timer.callback = nullptr;
+        timer.pending = false;
+        if (!++timer.generation)
+        {
+            timer.generation = 1;
+        }
+
+        timer.next = m_freeList;
+        m_freeList = index;
+        m_count--;
+    }
+
+    std::uint32_t Timers::_cascade(std::uint32_t level)
+    {
+        std::uint32_t shift = ROOT_BITS + (level - 1) * LEVEL_BITS;
+        std::uint32_t index = (m_currentTick >> shift) & (LEVEL_SIZE - 1);
+        std::uint32_t slot = ROOT_SIZE + (level - 1) * LEVEL_SIZE + index;
+
+        std::uint32_t timerIndex = m_slots[slot];
+        m_slots[slot] = NIL;
+
+        while (timerIndex != NIL)
+        {
+            std::uint32_t next = m_timers[timerIndex].next;
+            m_timers[timerIndex].pending = false;
+            _link(timerIndex);
+            timerIndex = next;
+        }
+
+        return index;
+    }
+
+    void Timers::_fire(std::uint32_t index)
+    {
+        Timer &timer = m_timers[index];
+        auto id = TimerId(static_cast<std::uint32_t>(timer.generation) << 16 | index);
+
+        _unlink(index);
+
+        if ((timer.flags & TimerFlags::Repeat) != TimerFlags::Repeat)
+        {
+            TimerCallback callback = std::move(timer.callback);
+            _release(index);
+            callback(id);
+            return;
+        }
+
+        timer.expires = m_now + timer.interval;
+        _link(index);
+
+        m_firing = index;
+        m_firingCancelled = false;
+        timer.callback(id);
+        m_firing = NIL;
+
+        if (m_firingCancelled)
+        {
+            _release(index);
+        }
+    }
+} // namespace Anubis
@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <ITimers.hpp>
+#include <IHelpers.hpp>
+
+#include <array>
+#include <deque>
+
+namespace Anubis
+{
+    class Timers final : public ITimers
+    {
+    public:
+        static constexpr std::uint32_t TICKS_PER_SECOND = 100;
+
+    public:
+        Timers();
+        ~Timers() final = default;
+
+        TimerId schedule(float delay, TimerCallback callback, TimerFlags flags) final;
+        bool cancel(TimerId id) final;
+        [[nodiscard]] bool isPending(TimerId id) const final;
+        [[nodiscard]] float getTimeLeft(TimerId id) const final;
+        [[nodiscard]] std::size_t getCount() const final;
+
+        void advance(float time);
+        void cancelMapScoped();
+
+    private:
+        /* Slots of the first level are indexed by the lowest 8 bits of the expiration tick,
+         * every next level covers another 6 bits. Delays above the last level are clamped. */
+        static constexpr std::uint32_t ROOT_BITS = 8;
+        static constexpr std::uint32_t LEVEL_BITS = 6;
+        static constexpr std::uint32_t LEVELS = 4;
+        static constexpr std::uint32_t ROOT_SIZE = 1 << ROOT_BITS;
+        static constexpr std::uint32_t LEVEL_SIZE = 1 << LEVEL_BITS;
+        static constexpr std::uint32_t MAX_TICKS = (1u << (ROOT_BITS + (LEVELS - 1) * LEVEL_BITS)) - 1;
+        static constexpr std::uint32_t NIL = 0xFFFFFFFF;
+
+        struct Timer
+        {
+            TimerCallback callback;
+            std::uint32_t interval = 0;
+            std::uint32_t expires = 0;
+            std::uint32_t prev = NIL;
+            std::uint32_t next = NIL;
+            std::uint32_t slot = NIL;
+            std::uint16_t generation = 1;
+            TimerFlags flags = TimerFlags::None;
+            bool pending = false;
+        };
+
+    private:
+        [[nodiscard]] std::uint32_t _decode(TimerId id) const;
+        [[nodiscard]] std::uint32_t _slotFor(std::uint32_t expires) const;
+        void _link(std::uint32_t index);
+        void _unlink(std::uint32_t index);
+        void _release(std::uint32_t index);
+        std::uint32_t _cascade(std::uint32_t level);
+        void _fire(std::uint32_t index);
+
+    private:
+        /* deque keeps references stable, callbacks are allowed to schedule new timers while being called */
+        std::deque<Timer> m_timers;
+        std::array<std::uint32_t, ROOT_SIZE + (LEVELS - 1) * LEVEL_SIZE> m_slots;
+        std::uint32_t m_freeList = NIL;
+        std::uint32_t m_firing = NIL;
+        bool m_firingCancelled = false;
+        std::uint32_t m_currentTick = 1;
+        std::uint32_t m_now = 0;
+        std::uint32_t m_baseTick = 0;
+        float m_baseTime = 0.0f;
+        float m_lastTime;
+        std::size_t m_count = 0;
+    };
+} // namespace Anubis
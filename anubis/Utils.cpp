@@ -39,4 +39,45 @@ namespace Anubis::Utils
 
         return result;
     }
+
+    bool parseIPv4(std::string_view address, std::uint32_t &ip)
+    {
+        address = address.substr(0, address.find(':'));
+
+        std::uint32_t result = 0;
+        std::size_t octets = 0;
+        std::size_t pos = 0;
+        while (octets < 4)
+        {
+            std::uint32_t octet = 0;
+            std::size_t digits = 0;
+            for (; pos < address.length() && address[pos] >= '0' && address[pos] <= '9' && digits < 3; pos++, digits++)
+            {
+                octet = octet * 10 + static_cast<std::uint32_t>(address[pos] - '0');
+            }
+
+            if (!digits || octet > 255)
+            {
+                return false;
+            }
+
+            result = (result << 8) | octet;
+            if (++octets < 4)
+            {
+                if (pos >= address.length() || address[pos] != '.')
+                {
+                    return false;
+                }
+                pos++;
+            }
+        }
+
+        if (pos != address.length())
+        {
+            return false;
+        }
+
+        ip = result;
+        return true;
+    }
 }
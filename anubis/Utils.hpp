@@ -19,10 +19,14 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace Anubis::Utils
 {
     void toLower(std::string &str);
     std::string toLowerCopy(std::string_view str);
+
+    /* Parses dotted IPv4 address, optional port after colon is ignored */
+    bool parseIPv4(std::string_view address, std::uint32_t &ip);
 }
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ClientInfo.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    bool keyLess(const std::pair<std::string, std::string> &lhs, const std::pair<std::string, std::string> &rhs)
+    {
+        return lhs.first < rhs.first;
+    }
+} // namespace
+
+namespace Anubis::Engine
+{
+    bool ClientInfo::isValid() const
+    {
+        return m_valid;
+    }
+
+    std::string_view ClientInfo::getAuthID() const
+    {
+        return m_authID;
+    }
+
+    UserID ClientInfo::getUserID() const
+    {
+        return m_userID;
+    }
+
+    std::string_view ClientInfo::getInfoValue(std::string_view key) const
+    {
+        auto it = std::lower_bound(m_info.begin(), m_info.end(), key,
+                                   [](const std::pair<std::string, std::string> &entry, std::string_view key)
+                                   {
+                                       return entry.first < key;
+                                   });
+
+        if (it == m_info.end() || it->first != key)
+        {
+            return {};
+        }
+
+        return it->second;
+    }
+
+    void ClientInfo::setAuthID(std::string_view authID)
+    {
+        m_authID = authID;
+    }
+
+    void ClientInfo::setUserID(UserID userID)
+    {
+        m_userID = userID;
+    }
+
+    const std::vector<std::string_view> &ClientInfo::parseInfoBuffer(std::string_view infoBuffer)
+    {
+        // \key1\value1\key2\value2
+        m_parsedInfo.clear();
+        std::size_t pos = 0;
+        while (pos < infoBuffer.size())
+        {
+            if (infoBuffer[pos] == '\\')
+            {
+                pos++;
+            }
+
+            std::size_t keyEnd = infoBuffer.find('\\', pos);
+            if (keyEnd == std::string_view::npos)
+            {
+                break;
+            }
+
+            std::size_t valueEnd = std::min(infoBuffer.find('\\', keyEnd + 1), infoBuffer.size());
+            m_parsedInfo.emplace_back(infoBuffer.substr(pos, keyEnd - pos),
+                                      infoBuffer.substr(keyEnd + 1, valueEnd - keyEnd - 1));
+            pos = valueEnd;
+        }
+        std::sort(m_parsedInfo.begin(), m_parsedInfo.end(), keyLess);
+
+        m_changedKeys.clear();
+        if (m_valid)
+        {
+            auto oldIt = m_info.cbegin();
+            auto newIt = m_parsedInfo.cbegin();
+            while (oldIt != m_info.cend() || newIt != m_parsedInfo.cend())
+            {
+                if (newIt == m_parsedInfo.cend() || (oldIt != m_info.cend() && oldIt->first < newIt->first))
+                {
+                    // key removed
+                    m_changedKeys.emplace_back((oldIt++)->first);
+                }
+                else if (oldIt == m_info.cend() || newIt->first < oldIt->first)
+                {
+                    // key added
+                    m_changedKeys.emplace_back((newIt++)->first);
+                }
+                else
+                {
+                    if (oldIt->second != newIt->second)
+                    {
+                        m_changedKeys.emplace_back(newIt->first);
+                    }
+                    ++oldIt;
+                    ++newIt;
+                }
+            }
+        }
+
+        m_info.swap(m_parsedInfo);
+        m_valid = true;
+
+        m_changedKeysView.assign(m_changedKeys.cbegin(), m_changedKeys.cend());
+        return m_changedKeysView;
+    }
+
+    void ClientInfo::clear()
+    {
+        m_valid = false;
+        m_authID.clear();
+        m_userID = UserID(0);
+        m_info.clear();
+    }
+} // namespace Anubis::Engine
@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <engine/IClientInfo.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Anubis::Engine
+{
+    class ClientInfo final : public IClientInfo
+    {
+    public:
+        ClientInfo() = default;
+        ~ClientInfo() final = default;
+
+        [[nodiscard]] bool isValid() const final;
+        [[nodiscard]] std::string_view getAuthID() const final;
+        [[nodiscard]] UserID getUserID() const final;
+        [[nodiscard]] std::string_view getInfoValue(std::string_view key) const final;
+
+        void setAuthID(std::string_view authID);
+        void setUserID(UserID userID);
+
+        /* Returns keys whose values differ from the previously cached ones */
+        const std::vector<std::string_view> &parseInfoBuffer(std::string_view infoBuffer);
+        void clear();
+
+    private:
+        bool m_valid = false;
+        std::string m_authID;
+        UserID m_userID = UserID(0);
+        std::vector<std::pair<std::string, std::string>> m_info;
+        std::vector<std::pair<std::string, std::string>> m_parsedInfo;
+        std::vector<std::string> m_changedKeys;
+        std::vector<std::string_view> m_changedKeysView;
+    };
+} // namespace Anubis::Engine
@@ -46,15 +46,7 @@ namespace Anubis::Engine
           m_regUserMsgRegistry(std::make_unique<RegUserMsgHookRegistry>()),
           m_getPlayerAuthIDRegistry(std::make_unique<GetPlayerAuthIDHookRegistry>()),
           m_getPlayerUserIDRegistry(std::make_unique<GetPlayerUserIDHookRegistry>()),
-          m_svDropClientRegistry(std::make_unique<SVDropClientHookRegistry>(
-              [&rehldsHooks]()
-              {
-                  rehldsHooks->SV_DropClient()->registerHook(ReHooks::SV_DropClientHook);
-              },
-              [&rehldsHooks]()
-              {
-                  rehldsHooks->SV_DropClient()->unregisterHook(ReHooks::SV_DropClientHook);
-              })),
+          m_svDropClientRegistry(std::make_unique<SVDropClientHookRegistry>()),
           m_cvarDirectSetReRegistry(std::make_unique<CvarDirectSetHookRegistry>(
               [&rehldsHooks]()
               {
@@ -110,7 +102,9 @@ namespace Anubis::Engine
           m_traceSphereHookRegistry(std::make_unique<TraceSphereHookRegistry>()),
           m_setOriginHookRegistry(std::make_unique<SetOriginHookRegistry>()),
           m_setSizeHookRegistry(std::make_unique<SetSizeHookRegistry>()),
-          m_createNamedEntityHookRegistry(std::make_unique<CreateNamedEntityHookRegistry>())
+          m_createNamedEntityHookRegistry(std::make_unique<CreateNamedEntityHookRegistry>()),
+          m_edFreeRegistry(std::make_unique<EdFreeHookRegistry>()),
+          m_clientInfoChangedRegistry(std::make_unique<ClientInfoChangedHookRegistry>())
     {
     }
 
@@ -440,4 +434,14 @@ namespace Anubis::Engine
     {
         return m_createNamedEntityHookRegistry;
     }
+
+    nstd::observer_ptr<IEdFreeHookRegistry> Hooks::edFree()
+    {
+        return m_edFreeRegistry;
+    }
+
+    nstd::observer_ptr<IClientInfoChangedHookRegistry> Hooks::clientInfoChanged()
+    {
+        return m_clientInfoChangedRegistry;
+    }
 } // namespace Anubis::Engine
@@ -176,6 +176,13 @@ namespace Anubis::Engine
     using EdAllocHook = Hook<nstd::observer_ptr<IEdict>>;
     using EdAllocHookRegistry = HookRegistry<nstd::observer_ptr<IEdict>>;
 
+    using EdFreeHook = Hook<void, nstd::observer_ptr<IEdict>>;
+    using EdFreeHookRegistry = HookRegistry<void, nstd::observer_ptr<IEdict>>;
+
+    using ClientInfoChangedHook = Hook<void, nstd::observer_ptr<IEdict>, const std::vector<std::string_view> &>;
+    using ClientInfoChangedHookRegistry =
+        HookRegistry<void, nstd::observer_ptr<IEdict>, const std::vector<std::string_view> &>;
+
     using StringFromOffsetHook = Hook<std::string_view, StringOffset>;
     using StringFromOffsetHookRegistry = HookRegistry<std::string_view, StringOffset>;
 
@@ -394,6 +401,8 @@ namespace Anubis::Engine
         nstd::observer_ptr<ISetOriginHookRegistry> setOrigin() final;
         nstd::observer_ptr<ISetSizeHookRegistry> setSize() final;
         nstd::observer_ptr<ICreateNamedEntityHookRegistry> createNamedEntity() final;
+        nstd::observer_ptr<IEdFreeHookRegistry> edFree() final;
+        nstd::observer_ptr<IClientInfoChangedHookRegistry> clientInfoChanged() final;
 
     private:
         std::unique_ptr<PrecacheModelHookRegistry> m_precacheModelRegistry;
@@ -465,5 +474,7 @@ namespace Anubis::Engine
         std::unique_ptr<SetOriginHookRegistry> m_setOriginHookRegistry;
         std::unique_ptr<SetSizeHookRegistry> m_setSizeHookRegistry;
         std::unique_ptr<CreateNamedEntityHookRegistry> m_createNamedEntityHookRegistry;
+        std::unique_ptr<EdFreeHookRegistry> m_edFreeRegistry;
+        std::unique_ptr<ClientInfoChangedHookRegistry> m_clientInfoChangedRegistry;
     };
 } // namespace Anubis::Engine
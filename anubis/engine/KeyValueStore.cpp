@@ -0,0 +1,129 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "KeyValueStore.hpp"
+
+#include <algorithm>
+
+namespace Anubis::Engine
+{
+    KeyValueStore::KeyValueStore() : m_ranges(EDICTS_LIMIT) {}
+
+    void KeyValueStore::add(std::uint32_t index, std::string_view key, std::string_view value)
+    {
+        if (index >= m_ranges.size())
+        {
+            return;
+        }
+
+        auto keyIt = m_keyIds.find(key);
+        if (keyIt == m_keyIds.end())
+        {
+            const std::string &keyName = m_keys.emplace_back(key);
+            keyIt = m_keyIds.emplace(keyName, static_cast<std::uint32_t>(m_keys.size() - 1)).first;
+        }
+
+        // Entries added to the edict later are moved after the last entry to keep them contiguous
+        Range &range = m_ranges[index];
+        if (range.num && range.first + range.num != m_entries.size())
+        {
+            auto first = static_cast<std::uint32_t>(m_entries.size());
+            for (std::uint32_t i = range.first; i < range.first + range.num; i++)
+            {
+                Entry entry = m_entries[i];
+                m_entries.push_back(entry);
+            }
+            range.first = first;
+        }
+        else if (!range.num)
+        {
+            range.first = static_cast<std::uint32_t>(m_entries.size());
+        }
+
+        m_entries.push_back(
+            {keyIt->second, static_cast<std::uint32_t>(m_values.size()), static_cast<std::uint32_t>(value.size())});
+        m_values.insert(m_values.end(), value.begin(), value.end());
+        m_values.push_back('\0');
+        range.num++;
+    }
+
+    std::optional<std::string_view> KeyValueStore::find(std::uint32_t index, std::string_view key) const
+    {
+        if (index >= m_ranges.size())
+        {
+            return std::nullopt;
+        }
+
+        auto keyIt = m_keyIds.find(key);
+        if (keyIt == m_keyIds.end())
+        {
+            return std::nullopt;
+        }
+
+        // The last value of the key is the one the game has kept
+        const Range &range = m_ranges[index];
+        for (std::uint32_t i = range.num; i > 0; i--)
+        {
+            if (const Entry &entry = m_entries[range.first + i - 1]; entry.key == keyIt->second)
+            {
+                return _getValue(entry);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::vector<std::pair<std::string_view, std::string_view>> KeyValueStore::getAll(std::uint32_t index) const
+    {
+        std::vector<std::pair<std::string_view, std::string_view>> keyValues;
+        if (index >= m_ranges.size())
+        {
+            return keyValues;
+        }
+
+        const Range &range = m_ranges[index];
+        keyValues.reserve(range.num);
+        for (std::uint32_t i = range.first; i < range.first + range.num; i++)
+        {
+            keyValues.emplace_back(m_keys[m_entries[i].key], _getValue(m_entries[i]));
+        }
+
+        return keyValues;
+    }
+
+    void KeyValueStore::remove(std::uint32_t index)
+    {
+        if (index < m_ranges.size())
+        {
+            m_ranges[index] = {};
+        }
+    }
+
+    void KeyValueStore::clear()
+    {
+        m_values.clear();
+        m_entries.clear();
+        std::fill(m_ranges.begin(), m_ranges.end(), Range {});
+    }
+
+    std::string_view KeyValueStore::_getValue(const Entry &entry) const
+    {
+        return {m_values.data() + entry.valueOffset, entry.valueSize};
+    }
+} // namespace Anubis::Engine
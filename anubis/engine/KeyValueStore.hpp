@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <engine/Common.hpp>
+
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Anubis::Engine
+{
+    /* Key values of map entities as the game received them while the map was loading.
+     * Keys are interned, values are kept in a single arena and entries of the edict are contiguous. */
+    class KeyValueStore
+    {
+    public:
+        KeyValueStore();
+
+        void add(std::uint32_t index, std::string_view key, std::string_view value);
+        [[nodiscard]] std::optional<std::string_view> find(std::uint32_t index, std::string_view key) const;
+        [[nodiscard]] std::vector<std::pair<std::string_view, std::string_view>> getAll(std::uint32_t index) const;
+        void remove(std::uint32_t index);
+        void clear();
+
+    private:
+        struct Entry
+        {
+            std::uint32_t key;
+            std::uint32_t valueOffset;
+            std::uint32_t valueSize;
+        };
+
+        struct Range
+        {
+            std::uint32_t first = 0;
+            std::uint32_t num = 0;
+        };
+
+    private:
+        [[nodiscard]] std::string_view _getValue(const Entry &entry) const;
+
+    private:
+        std::deque<std::string> m_keys; // keys of ids point here
+        std::unordered_map<std::string_view, std::uint32_t> m_keyIds;
+        std::vector<char> m_values; // null terminated
+        std::vector<Entry> m_entries;
+        std::vector<Range> m_ranges; // indexed by edict
+    };
+} // namespace Anubis::Engine
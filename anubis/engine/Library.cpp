@@ -26,15 +26,36 @@
 #include "Cvar.hpp"
 #include "Edict.hpp"
 #include "ReHooks.hpp"
+#include "MsgBuilder.hpp"
 
 #include <AnubisCvars.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 using namespace std::string_literals;
 
 namespace Anubis::Engine
 {
+    namespace
+    {
+        template<typename t_fn>
+        PrecacheId precacheCached(PrecacheType type, std::string_view name, t_fn precacheFn)
+        {
+            const auto &precacheManager = gAnubisApi->getPrecacheManager();
+            if (auto cachedId = precacheManager->find(type, name); cachedId)
+            {
+                precacheManager->markRequested(type, name);
+                return *cachedId;
+            }
+
+            PrecacheId id(precacheFn(name.data()));
+            precacheManager->add(type, name, id);
+            return id;
+        }
+    } // namespace
+
     Library::Library(std::unique_ptr<enginefuncs_t> &&engineFuncs, nstd::observer_ptr<globalvars_t> globals)
         : m_engineFuncs(std::make_unique<enginefuncs_t>()),
           m_origEngineFuncs(std::move(engineFuncs)),
@@ -51,6 +72,10 @@ namespace Anubis::Engine
                            static_cast<std::uint32_t>(m_reHLDSAPI->GetMinorVersion())};
 
         _initGameClients();
+        m_msgScheduler = std::make_unique<MsgScheduler>(getMaxClientsLimit());
+        m_tempEntityBatch = std::make_unique<TempEntityBatch>();
+        m_visibilityCache = std::make_unique<VisibilityCache>(getMaxClientsLimit());
+        m_keyValueStore = std::make_unique<KeyValueStore>();
 
         m_hooks = std::make_unique<Hooks>(m_reHookchains);
         Callbacks::GameDLL::getEngine(this);
@@ -58,6 +83,12 @@ namespace Anubis::Engine
 
         m_reHLDSFuncs->AddCvarListener(gAnubisLogLevelCvar.name, CvarListener::anubisLogLevel);
         m_reHookchains->ED_Alloc()->registerHook(ReHooks::ED_Alloc);
+        m_reHookchains->ED_Free()->registerHook(ReHooks::ED_Free);
+        m_reHookchains->SV_DropClient()->registerHook(ReHooks::SV_DropClientHook);
+
+        m_edicts.resize(EDICTS_LIMIT);
+        m_edictsGeneration.fill(1);
+        m_edictsInUse.fill(0);
     }
 
     nstd::observer_ptr<IEdict> Library::getEdict(std::uint32_t index, FuncCallType callType) const
@@ -164,7 +195,7 @@ namespace Anubis::Engine
     {
         if (callType == FuncCallType::Direct)
         {
-            return PrecacheId(m_origEngineFuncs->pfnPrecacheModel(model.data()));
+            return precacheCached(PrecacheType::Model, model, m_origEngineFuncs->pfnPrecacheModel);
         }
 
         static auto hookChain = m_hooks->precacheModel();
@@ -172,7 +203,7 @@ namespace Anubis::Engine
         return hookChain->callChain(
             [this](std::string_view model)
             {
-                return PrecacheId(m_origEngineFuncs->pfnPrecacheModel(model.data()));
+                return precacheCached(PrecacheType::Model, model, m_origEngineFuncs->pfnPrecacheModel);
             },
             model);
     }
@@ -181,7 +212,7 @@ namespace Anubis::Engine
     {
         if (callType == FuncCallType::Direct)
         {
-            return PrecacheId(m_origEngineFuncs->pfnPrecacheSound(sound.data()));
+            return precacheCached(PrecacheType::Sound, sound, m_origEngineFuncs->pfnPrecacheSound);
         }
 
         static auto hookChain = m_hooks->precacheSound();
@@ -189,7 +220,7 @@ namespace Anubis::Engine
         return hookChain->callChain(
             [this](std::string_view sound)
             {
-                return PrecacheId(m_origEngineFuncs->pfnPrecacheSound(sound.data()));
+                return precacheCached(PrecacheType::Sound, sound, m_origEngineFuncs->pfnPrecacheSound);
             },
             sound);
     }
@@ -198,7 +229,7 @@ namespace Anubis::Engine
     {
         if (callType == FuncCallType::Direct)
         {
-            return PrecacheId(m_origEngineFuncs->pfnPrecacheGeneric(generic.data()));
+            return precacheCached(PrecacheType::Generic, generic, m_origEngineFuncs->pfnPrecacheGeneric);
         }
 
         static auto hookChain = m_hooks->precacheGeneric();
@@ -206,7 +237,7 @@ namespace Anubis::Engine
         return hookChain->callChain(
             [this](std::string_view generic)
             {
-                return PrecacheId(m_origEngineFuncs->pfnPrecacheGeneric(generic.data()));
+                return precacheCached(PrecacheType::Generic, generic, m_origEngineFuncs->pfnPrecacheGeneric);
             },
             generic);
     }
@@ -539,6 +570,11 @@ namespace Anubis::Engine
     {
         if (callType == FuncCallType::Direct)
         {
+            if (m_cmdArgsOverridden)
+            {
+                return m_cmdArgsOverride;
+            }
+
             const char *result = m_origEngineFuncs->pfnCmd_Args();
             return (result) ? std::string_view {result} : std::string_view {};
         }
@@ -546,8 +582,13 @@ namespace Anubis::Engine
         static auto hookChain = m_hooks->cmdArgs();
 
         return hookChain->callChain(
-            [this]()
+            [this]() -> std::string_view
             {
+                if (m_cmdArgsOverridden)
+                {
+                    return m_cmdArgsOverride;
+                }
+
                 const char *result = m_origEngineFuncs->pfnCmd_Args();
                 return (result) ? std::string_view {result} : std::string_view {};
             });
@@ -557,14 +598,25 @@ namespace Anubis::Engine
     {
         if (callType == FuncCallType::Direct)
         {
+            if (m_cmdArgsOverridden)
+            {
+                // Engine returns an empty string for arguments out of range
+                return (argc < m_cmdArgvOverride.size()) ? m_cmdArgvOverride[argc] : std::string_view {""};
+            }
+
             return m_origEngineFuncs->pfnCmd_Argv(argc);
         }
 
         static auto hookChain = m_hooks->cmdArgv();
 
         return hookChain->callChain(
-            [this](std::uint8_t argc)
+            [this](std::uint8_t argc) -> std::string_view
             {
+                if (m_cmdArgsOverridden)
+                {
+                    return (argc < m_cmdArgvOverride.size()) ? m_cmdArgvOverride[argc] : std::string_view {""};
+                }
+
                 return m_origEngineFuncs->pfnCmd_Argv(static_cast<int>(argc));
             },
             std::uint8_t {argc});
@@ -574,6 +626,11 @@ namespace Anubis::Engine
     {
         if (callType == FuncCallType::Direct)
         {
+            if (m_cmdArgsOverridden)
+            {
+                return static_cast<std::uint8_t>(m_cmdArgvOverride.size());
+            }
+
             return m_origEngineFuncs->pfnCmd_Argc();
         }
 
@@ -582,6 +639,11 @@ namespace Anubis::Engine
         return hookChain->callChain(
             [this]()
             {
+                if (m_cmdArgsOverridden)
+                {
+                    return static_cast<std::uint8_t>(m_cmdArgvOverride.size());
+                }
+
                 return static_cast<std::uint8_t>(m_origEngineFuncs->pfnCmd_Argc());
             });
     }
@@ -1062,7 +1124,7 @@ namespace Anubis::Engine
     {
         if (callType == FuncCallType::Direct)
         {
-            return ModelIndex(m_origEngineFuncs->pfnModelIndex(model.data()));
+            return _modelIndex(model);
         }
 
         static auto hookChain = m_hooks->modelIndex();
@@ -1070,7 +1132,7 @@ namespace Anubis::Engine
         return hookChain->callChain(
             [this](std::string_view model)
             {
-                return ModelIndex(m_origEngineFuncs->pfnModelIndex(model.data()));
+                return _modelIndex(model);
             },
             model);
     }
@@ -1174,24 +1236,35 @@ namespace Anubis::Engine
                             Pitch pitch,
                             FuncCallType callType) const
     {
+        auto emitSoundFn = [this](nstd::observer_ptr<IEdict> entity, Channel channel, std::string_view sample,
+                                  float volume, float attenuation, SoundFlags fFlags, Pitch pitch)
+        {
+            auto edict = static_cast<edict_t *>(*entity);
+
+            // Engine emits the sound from the center of the entity's bounding box
+            std::array<float, 3> origin = {};
+            for (std::size_t i = 0; i < origin.size(); i++)
+            {
+                origin[i] = edict->v.origin[i] + (edict->v.mins[i] + edict->v.maxs[i]) * 0.5f;
+            }
+
+            if (_cullSound(entity->getIndex(), origin, channel, sample, volume, attenuation, fFlags, pitch))
+            {
+                return;
+            }
+
+            m_origEngineFuncs->pfnEmitSound(edict, static_cast<int>(channel), sample.data(), volume, attenuation,
+                                            static_cast<int>(fFlags), static_cast<int>(pitch));
+        };
+
         if (callType == FuncCallType::Direct)
         {
-            return m_origEngineFuncs->pfnEmitSound(static_cast<edict_t *>(*entity), static_cast<int>(channel),
-                                                   sample.data(), volume, attenuation, static_cast<int>(fFlags),
-                                                   static_cast<int>(pitch));
+            return emitSoundFn(entity, channel, sample, volume, attenuation, fFlags, pitch);
         }
 
         static auto hookChain = m_hooks->emitSound();
 
-        return hookChain->callChain(
-            [this](nstd::observer_ptr<IEdict> entity, Channel channel, std::string_view sample, float volume,
-                   float attenuation, SoundFlags fFlags, Pitch pitch)
-            {
-                return m_origEngineFuncs->pfnEmitSound(static_cast<edict_t *>(*entity), static_cast<int>(channel),
-                                                       sample.data(), volume, attenuation, static_cast<int>(fFlags),
-                                                       static_cast<int>(pitch));
-            },
-            entity, channel, sample, volume, attenuation, fFlags, pitch);
+        return hookChain->callChain(emitSoundFn, entity, channel, sample, volume, attenuation, fFlags, pitch);
     }
 
     void Library::emitAmbientSound(nstd::observer_ptr<IEdict> entity,
@@ -1203,24 +1276,28 @@ namespace Anubis::Engine
                                    Pitch pitch,
                                    FuncCallType callType) const
     {
+        auto emitAmbientSoundFn = [this](nstd::observer_ptr<IEdict> entity, std::array<float, 3> pos,
+                                         std::string_view samp, SndVolume volume, SndAttenuation attenuation,
+                                         SoundFlags fFlags, Pitch pitch)
+        {
+            if (_cullSound(entity->getIndex(), pos, Channel::Static, samp, volume, attenuation, fFlags, pitch))
+            {
+                return;
+            }
+
+            m_origEngineFuncs->pfnEmitAmbientSound(static_cast<edict_t *>(*entity), pos.data(), samp.data(), volume,
+                                                   attenuation, static_cast<int>(fFlags), static_cast<int>(pitch));
+        };
+
         if (callType == FuncCallType::Direct)
         {
-            return m_origEngineFuncs->pfnEmitAmbientSound(static_cast<edict_t *>(*entity), position.data(),
-                                                          sample.data(), volume, attenuation, static_cast<int>(fFlags),
-                                                          static_cast<int>(pitch));
+            return emitAmbientSoundFn(entity, position, sample, volume, attenuation, fFlags, pitch);
         }
 
         static auto hookChain = m_hooks->emitAmbientSound();
 
-        return hookChain->callChain(
-            [this](nstd::observer_ptr<IEdict> entity, std::array<float, 3> pos, std::string_view samp, SndVolume volume,
-                   SndAttenuation attenuation, SoundFlags fFlags, Pitch pitch)
-            {
-                return m_origEngineFuncs->pfnEmitAmbientSound(static_cast<edict_t *>(*entity), pos.data(), samp.data(),
-                                                              volume, attenuation, static_cast<int>(fFlags),
-                                                              static_cast<int>(pitch));
-            },
-            entity, position, sample, volume, attenuation, fFlags, pitch);
+        return hookChain->callChain(emitAmbientSoundFn, entity, position, sample, volume, attenuation, fFlags,
+                                    pitch);
     }
 
     void Library::traceLine(std::array<float, 3> start,
@@ -1583,7 +1660,13 @@ namespace Anubis::Engine
 
     void Library::initEdict(edict_t *edict)
     {
-        m_edicts.try_emplace(m_origEngineFuncs->pfnIndexOfEdict(edict), std::make_unique<Edict>(edict, this));
+        std::uint32_t index = m_origEngineFuncs->pfnIndexOfEdict(edict);
+        if (!m_edicts[index])
+        {
+            m_edicts[index] = std::make_unique<Edict>(edict, this);
+        }
+
+        m_edictsInUse[index / 32] |= 1u << (index % 32);
     }
 
     void Library::_initGameClients()
@@ -1595,6 +1678,13 @@ namespace Anubis::Engine
             m_gameClients.emplace_back(
                 std::make_unique<GameClient>(m_reServerStatic->GetClient(static_cast<int>(i)), this));
         }
+
+        // indexed by edict index, 0 is worldspawn
+        m_clientsInfo.reserve(maxClientsLimit + 1);
+        for (std::size_t i = 0; i <= maxClientsLimit; i++)
+        {
+            m_clientsInfo.emplace_back(std::make_unique<ClientInfo>());
+        }
     }
 
     nstd::observer_ptr<IGameClient> Library::getGameClient(std::uint32_t index) const
@@ -1630,6 +1720,8 @@ namespace Anubis::Engine
     void Library::removeHooks()
     {
         m_reHookchains->ED_Alloc()->unregisterHook(ReHooks::ED_Alloc);
+        m_reHookchains->ED_Free()->unregisterHook(ReHooks::ED_Free);
+        m_reHookchains->SV_DropClient()->unregisterHook(ReHooks::SV_DropClientHook);
     }
 
     void Library::initPlayerEdicts()
@@ -1637,7 +1729,653 @@ namespace Anubis::Engine
         const auto maxPlayerEdicts = static_cast<std::uint16_t>(m_reServerStatic->GetMaxClients());
         for (std::size_t i = 1; i <= maxPlayerEdicts; i++)
         {
-            m_edicts.try_emplace(i, std::make_unique<Edict>(m_reServerData->GetEdict(static_cast<int>(i)), this));
+            if (!m_edicts[i])
+            {
+                m_edicts[i] = std::make_unique<Edict>(m_reServerData->GetEdict(static_cast<int>(i)), this);
+            }
+        }
+    }
+
+    EdictHandle Library::getEdictHandle(nstd::observer_ptr<IEdict> edict) const
+    {
+        std::uint32_t index = edict->getIndex();
+        return EdictHandle(m_edictsGeneration[index] << EDICT_HANDLE_INDEX_BITS | index);
+    }
+
+    bool Library::isValidHandle(EdictHandle handle) const
+    {
+        std::uint32_t index = handle & EDICT_HANDLE_INDEX_MASK;
+        if ((handle >> EDICT_HANDLE_INDEX_BITS) != m_edictsGeneration[index])
+        {
+            return false;
         }
+
+        const auto &edict = m_edicts[index];
+        return edict && !edict->isFree();
+    }
+
+    nstd::observer_ptr<IEdict> Library::getEdict(EdictHandle handle) const
+    {
+        if (!isValidHandle(handle))
+        {
+            return {};
+        }
+
+        return m_edicts[handle & EDICT_HANDLE_INDEX_MASK];
+    }
+
+    void Library::invalidateEdict(const edict_t *edict)
+    {
+        constexpr std::uint32_t generationMask = 0xFFFFFFFF >> EDICT_HANDLE_INDEX_BITS;
+
+        std::uint32_t index = m_origEngineFuncs->pfnIndexOfEdict(edict);
+        std::uint32_t &generation = m_edictsGeneration[index];
+        generation = (generation + 1) & generationMask;
+
+        // 0 is reserved for the invalid handle
+        if (!generation)
+        {
+            generation = 1;
+        }
+
+        if (edict->free)
+        {
+            m_edictsInUse[index / 32] &= ~(1u << (index % 32));
+            m_keyValueStore->remove(index);
+        }
+    }
+
+    void Library::invalidateEdicts()
+    {
+        for (const auto &edict : m_edicts)
+        {
+            if (edict)
+            {
+                invalidateEdict(static_cast<edict_t *>(*edict));
+            }
+        }
+
+        // edicts are not freed one by one when the map ends
+        m_edictsInUse.fill(0);
+        m_visibilityCache->reset();
+        m_keyValueStore->clear();
+    }
+
+    EdictsRange Library::getEdictsInUse() const
+    {
+        std::uint32_t maxEdicts = EDICTS_LIMIT;
+        if (m_engineGlobals->maxEntities > 0)
+        {
+            maxEdicts = std::min(static_cast<std::uint32_t>(m_engineGlobals->maxEntities), EDICTS_LIMIT);
+        }
+
+        return {m_edictsInUse.data(), (maxEdicts + 31) / 32, m_edicts.data()};
+    }
+
+    nstd::observer_ptr<IClientInfo> Library::getClientInfo(nstd::observer_ptr<IEdict> player) const
+    {
+        std::uint32_t index = player->getIndex();
+        if (!index || index >= m_clientsInfo.size())
+        {
+            return {};
+        }
+
+        return m_clientsInfo[index];
+    }
+
+    void Library::updateClientInfo(nstd::observer_ptr<IEdict> player)
+    {
+        std::uint32_t index = player->getIndex();
+        if (!index || index >= m_clientsInfo.size())
+        {
+            return;
+        }
+
+        auto edict = static_cast<edict_t *>(*player);
+        const auto &clientInfo = m_clientsInfo[index];
+
+        const char *authID = m_origEngineFuncs->pfnGetPlayerAuthId(edict);
+        clientInfo->setAuthID(authID ? authID : "");
+        clientInfo->setUserID(UserID(m_origEngineFuncs->pfnGetPlayerUserId(edict)));
+
+        const char *infoBuffer = m_origEngineFuncs->pfnGetInfoKeyBuffer(edict);
+        const auto &changedKeys = clientInfo->parseInfoBuffer(infoBuffer ? infoBuffer : "");
+        if (changedKeys.empty())
+        {
+            return;
+        }
+
+        static auto hookChain = m_hooks->clientInfoChanged();
+        hookChain->callChain([](nstd::observer_ptr<IEdict>, const std::vector<std::string_view> &) {}, player,
+                             changedKeys);
+    }
+
+    void Library::clearClientInfo(nstd::observer_ptr<IEdict> player)
+    {
+        std::uint32_t index = player->getIndex();
+        if (!index || index >= m_clientsInfo.size())
+        {
+            return;
+        }
+
+        m_clientsInfo[index]->clear();
+    }
+
+    void Library::overrideCmdArgs(std::string_view cmd, std::string_view args)
+    {
+        // Both can point into the current override
+        std::string cmdName(cmd);
+        m_cmdArgsOverride = std::string(args);
+        args = m_cmdArgsOverride;
+
+        m_cmdArgvOverride.clear();
+        m_cmdArgvOverride.emplace_back(std::move(cmdName));
+
+        // Split the same way as the engine does, quoted arguments are kept together
+        std::size_t pos = 0;
+        while (pos < args.length() && m_cmdArgvOverride.size() < MAX_CMD_ARGS)
+        {
+            if (static_cast<unsigned char>(args[pos]) <= ' ')
+            {
+                pos++;
+                continue;
+            }
+
+            if (args[pos] == '"')
+            {
+                std::size_t end = args.find('"', ++pos);
+                if (end == std::string_view::npos)
+                {
+                    end = args.length();
+                }
+
+                m_cmdArgvOverride.emplace_back(args.substr(pos, end - pos));
+                pos = end + 1;
+                continue;
+            }
+
+            std::size_t end = pos;
+            while (end < args.length() && static_cast<unsigned char>(args[end]) > ' ')
+            {
+                end++;
+            }
+
+            m_cmdArgvOverride.emplace_back(args.substr(pos, end - pos));
+            pos = end;
+        }
+
+        m_cmdArgsOverridden = true;
+    }
+
+    void Library::clearCmdArgsOverride()
+    {
+        m_cmdArgsOverridden = false;
+    }
+
+    void Library::dropClient(nstd::observer_ptr<IGameClient> client, std::string_view reason)
+    {
+        m_reHLDSFuncs->DropClient(static_cast<::IGameClient *>(*client), false, "%s", std::string(reason).c_str());
+    }
+
+    std::unique_ptr<IMsgBuilder> Library::createMsgBuilder(MsgType msgType) const
+    {
+        return std::make_unique<MsgBuilder>(msgType, gAnubisApi->getMsgInfo(msgType)->getSize());
+    }
+
+    std::uint32_t Library::multicastMsg(const IMsgBuilder &msg, ClientsMask clients, bool reliable) const
+    {
+        if (!msg.isValid())
+        {
+            return 0;
+        }
+
+        // Engine does not modify the source buffer
+        auto data = const_cast<std::byte *>(msg.getData());
+        auto size = static_cast<int>(msg.getSize());
+        std::uint32_t maxClients = std::min(getMaxClients(), static_cast<std::uint32_t>(sizeof(clients) * 8));
+        std::uint32_t sentNum = 0;
+
+        for (std::uint32_t i = 0; i < maxClients && clients; i++, clients >>= 1)
+        {
+            if (!(clients & 1))
+            {
+                continue;
+            }
+
+            auto client = static_cast<::IGameClient *>(*m_gameClients[i]);
+            if (client->IsFakeClient() || (!client->IsActive() && !client->IsSpawned()))
+            {
+                continue;
+            }
+
+            sizebuf_t *buffer = reliable ? client->GetNetChan()->GetMessageBuf() : client->GetDatagram();
+            if (!reliable && buffer->cursize + size > buffer->maxsize)
+            {
+                continue;
+            }
+
+            m_reHLDSFuncs->MSG_WriteBuf(buffer, size, data);
+            sentNum++;
+        }
+
+        return sentNum;
+    }
+
+    std::uint32_t
+        Library::queueMsg(const IMsgBuilder &msg, ClientsMask clients, MsgPriority priority, std::uint32_t channel)
+    {
+        if (!msg.isValid())
+        {
+            return 0;
+        }
+
+        std::uint32_t maxClients = std::min(getMaxClients(), static_cast<std::uint32_t>(sizeof(clients) * 8));
+        std::uint32_t queuedNum = 0;
+
+        for (std::uint32_t i = 0; i < maxClients && clients; i++, clients >>= 1)
+        {
+            if (!(clients & 1))
+            {
+                continue;
+            }
+
+            auto client = static_cast<::IGameClient *>(*m_gameClients[i]);
+            if (client->IsFakeClient() || !client->IsConnected())
+            {
+                continue;
+            }
+
+            if (m_msgScheduler->push(i, msg, priority, channel))
+            {
+                queuedNum++;
+            }
+        }
+
+        return queuedNum;
+    }
+
+    MsgQueueStats Library::getMsgQueueStats(nstd::observer_ptr<IGameClient> client) const
+    {
+        return m_msgScheduler->getStats(static_cast<std::uint32_t>(static_cast<::IGameClient *>(*client)->GetId()));
+    }
+
+    void Library::sendQueuedMsgs(float time)
+    {
+        for (std::uint32_t i = 0; i < getMaxClients(); i++)
+        {
+            if (m_msgScheduler->isEmpty(i))
+            {
+                continue;
+            }
+
+            auto client = static_cast<::IGameClient *>(*m_gameClients[i]);
+            if (!client->IsActive() && !client->IsSpawned())
+            {
+                continue;
+            }
+
+            // Half of the reliable buffer is left for the engine and the game
+            sizebuf_t *buffer = client->GetNetChan()->GetMessageBuf();
+            auto limit = static_cast<std::size_t>(buffer->maxsize / 2);
+            auto used = static_cast<std::size_t>(buffer->cursize);
+
+            if ((buffer->flags & FSB_OVERFLOWED) || used >= limit)
+            {
+                continue;
+            }
+
+            m_msgScheduler->send(i, time, static_cast<float>(client->GetNetChan()->GetChan()->rate), limit - used,
+                                 [this, buffer](const std::byte *data, std::size_t size)
+                                 {
+                                     m_reHLDSFuncs->MSG_WriteBuf(buffer, static_cast<int>(size),
+                                                                 const_cast<std::byte *>(data));
+                                 });
+        }
+    }
+
+    void Library::clearMsgQueue(nstd::observer_ptr<IGameClient> client)
+    {
+        m_msgScheduler->clear(static_cast<std::uint32_t>(static_cast<::IGameClient *>(*client)->GetId()));
+    }
+
+    void Library::emitTempEntity(const TempEntityEvent &event, TempEntityRoute route, ClientsMask clients)
+    {
+        m_tempEntityBatch->push(event, route, clients);
+    }
+
+    void Library::sendTempEntities()
+    {
+        if (m_tempEntityBatch->isEmpty())
+        {
+            return;
+        }
+
+        const auto &events = m_tempEntityBatch->getEvents();
+        std::uint32_t maxClients = std::min(getMaxClients(), static_cast<std::uint32_t>(sizeof(ClientsMask) * 8));
+
+        _takeVisibilitySets();
+
+        ClientsMask receivers = m_visibilityCache->getPlayers();
+        for (std::uint32_t i = 0; i < maxClients; i++)
+        {
+            if (static_cast<::IGameClient *>(*m_gameClients[i])->IsFakeClient())
+            {
+                receivers &= ~(ClientsMask(1) << i);
+            }
+        }
+
+        // Probe is linked once per event to find the leafs it touches
+        m_tempEntityReceivers.assign(events.size(), 0);
+        for (std::size_t e = 0; e < events.size(); e++)
+        {
+            const TempEntityBatch::Event &event = events[e];
+            ClientsMask clients = event.clients & receivers;
+
+            if (event.route == TempEntityRoute::All)
+            {
+                m_tempEntityReceivers[e] = clients;
+                continue;
+            }
+
+            edict_t *probe = clients ? _getTempEntityProbe() : nullptr;
+            if (!probe)
+            {
+                continue;
+            }
+
+            m_origEngineFuncs->pfnSetOrigin(probe, event.origin.data());
+
+            for (std::uint32_t i = 0; i < maxClients && clients; i++, clients >>= 1)
+            {
+                if (!(clients & 1))
+                {
+                    continue;
+                }
+
+                PotentialSet set = event.route == TempEntityRoute::PAS ? PotentialSet::PAS : PotentialSet::PVS;
+                if (m_origEngineFuncs->pfnCheckVisibility(probe, m_visibilityCache->getSet(i, set)))
+                {
+                    m_tempEntityReceivers[e] |= ClientsMask(1) << i;
+                }
+            }
+        }
+
+        for (std::uint32_t i = 0; i < maxClients; i++)
+        {
+            if (!(receivers & (ClientsMask(1) << i)))
+            {
+                continue;
+            }
+
+            // All temporary entities of the frame go to the client in a single write
+            sizebuf_t *buffer = static_cast<::IGameClient *>(*m_gameClients[i])->GetDatagram();
+            auto freeSpace = static_cast<std::size_t>(std::max(buffer->maxsize - buffer->cursize, 0));
+            m_tempEntityData.resize(std::max(m_tempEntityData.size(), freeSpace));
+
+            std::size_t size =
+                m_tempEntityBatch->assemble(i, m_tempEntityReceivers, m_tempEntityData.data(), freeSpace);
+            if (size)
+            {
+                m_reHLDSFuncs->MSG_WriteBuf(buffer, static_cast<int>(size), m_tempEntityData.data());
+            }
+        }
+
+        m_tempEntityBatch->clear();
+    }
+
+    void Library::clearTempEntities()
+    {
+        m_tempEntityBatch->clear();
+        m_tempEntityProbe = INVALID_EDICT_HANDLE;
+    }
+
+    bool Library::isInPotentialSet(nstd::observer_ptr<IEdict> player,
+                                   nstd::observer_ptr<IEdict> entity,
+                                   PotentialSet set)
+    {
+        auto slot = _getVisibilitySlot(player);
+        if (!slot)
+        {
+            return false;
+        }
+
+        std::uint32_t index = entity->getIndex();
+        if (auto otherSlot = _getVisibilitySlot(entity); otherSlot)
+        {
+            return m_visibilityCache->getVisiblePlayers(*slot, set) & (ClientsMask(1) << *otherSlot);
+        }
+
+        if (index >= EDICTS_LIMIT || entity->isFree())
+        {
+            return false;
+        }
+
+        if (auto visible = m_visibilityCache->findEntity(*slot, set, index); visible)
+        {
+            return *visible;
+        }
+
+        bool visible = m_origEngineFuncs->pfnCheckVisibility(static_cast<edict_t *>(*entity),
+                                                             m_visibilityCache->getSet(*slot, set)) != 0;
+        m_visibilityCache->setEntity(*slot, set, index, visible);
+
+        return visible;
+    }
+
+    ClientsMask Library::getPlayersInPotentialSet(nstd::observer_ptr<IEdict> player, PotentialSet set)
+    {
+        auto slot = _getVisibilitySlot(player);
+
+        return slot ? m_visibilityCache->getVisiblePlayers(*slot, set) : 0;
+    }
+
+    void Library::invalidateVisibility()
+    {
+        // Engine returns the sets in its own static buffers, they are looked up once here where nothing uses them
+        if (!m_engineSets[0])
+        {
+            float origin[3] = {0.0f, 0.0f, 0.0f};
+            m_engineSets = {m_origEngineFuncs->pfnSetFatPVS(origin), m_origEngineFuncs->pfnSetFatPAS(origin)};
+        }
+
+        m_visibilityCache->reset();
+    }
+
+    void Library::_takeVisibilitySets() const
+    {
+        if (m_visibilityCache->areSetsTaken())
+        {
+            return;
+        }
+
+        m_visibilityCache->setSetsTaken();
+
+        // Sets can be asked for while the engine packs entities against its own sets kept in the same buffers
+        bool keepEngineSets = m_engineSets[0] && m_engineSets[1];
+        if (keepEngineSets)
+        {
+            std::memcpy(m_visibilityCache->getSpareSet(PotentialSet::PVS), m_engineSets[0], VisibilityCache::SET_SIZE);
+            std::memcpy(m_visibilityCache->getSpareSet(PotentialSet::PAS), m_engineSets[1], VisibilityCache::SET_SIZE);
+        }
+
+        std::uint32_t maxClients = std::min(getMaxClients(), static_cast<std::uint32_t>(sizeof(ClientsMask) * 8));
+        for (std::uint32_t i = 0; i < maxClients; i++)
+        {
+            auto client = static_cast<::IGameClient *>(*m_gameClients[i]);
+            if (!client->IsActive() && !client->IsSpawned())
+            {
+                continue;
+            }
+
+            edict_t *player = client->GetEdict();
+            vec3_t viewOrigin = player->v.origin + player->v.view_ofs;
+            std::memcpy(m_visibilityCache->getSet(i, PotentialSet::PVS), m_origEngineFuncs->pfnSetFatPVS(viewOrigin),
+                        VisibilityCache::SET_SIZE);
+            std::memcpy(m_visibilityCache->getSet(i, PotentialSet::PAS), m_origEngineFuncs->pfnSetFatPAS(viewOrigin),
+                        VisibilityCache::SET_SIZE);
+            m_visibilityCache->addPlayer(i, {viewOrigin[0], viewOrigin[1], viewOrigin[2]});
+        }
+
+        if (keepEngineSets)
+        {
+            std::memcpy(m_engineSets[0], m_visibilityCache->getSpareSet(PotentialSet::PVS), VisibilityCache::SET_SIZE);
+            std::memcpy(m_engineSets[1], m_visibilityCache->getSpareSet(PotentialSet::PAS), VisibilityCache::SET_SIZE);
+        }
+    }
+
+    void Library::_checkPlayersVisibility()
+    {
+        _takeVisibilitySets();
+
+        if (m_visibilityCache->arePlayersChecked())
+        {
+            return;
+        }
+
+        std::uint32_t maxClients = std::min(getMaxClients(), static_cast<std::uint32_t>(sizeof(ClientsMask) * 8));
+        ClientsMask players = m_visibilityCache->getPlayers();
+        for (std::uint32_t i = 0; i < maxClients; i++)
+        {
+            if (!(players & (ClientsMask(1) << i)))
+            {
+                continue;
+            }
+
+            ClientsMask visible = 0;
+            ClientsMask audible = 0;
+            unsigned char *pvs = m_visibilityCache->getSet(i, PotentialSet::PVS);
+            unsigned char *pas = m_visibilityCache->getSet(i, PotentialSet::PAS);
+
+            for (std::uint32_t j = 0; j < maxClients; j++)
+            {
+                if (!(players & (ClientsMask(1) << j)))
+                {
+                    continue;
+                }
+
+                edict_t *other = static_cast<::IGameClient *>(*m_gameClients[j])->GetEdict();
+                if (m_origEngineFuncs->pfnCheckVisibility(other, pvs))
+                {
+                    visible |= ClientsMask(1) << j;
+                }
+
+                if (m_origEngineFuncs->pfnCheckVisibility(other, pas))
+                {
+                    audible |= ClientsMask(1) << j;
+                }
+            }
+
+            m_visibilityCache->setVisiblePlayers(i, PotentialSet::PVS, visible);
+            m_visibilityCache->setVisiblePlayers(i, PotentialSet::PAS, audible);
+        }
+
+        m_visibilityCache->setPlayersChecked();
+    }
+
+    std::optional<std::uint32_t> Library::_getVisibilitySlot(nstd::observer_ptr<IEdict> player)
+    {
+        _checkPlayersVisibility();
+
+        std::uint32_t index = player->getIndex();
+        if (!index || index > sizeof(ClientsMask) * 8 ||
+            !(m_visibilityCache->getPlayers() & (ClientsMask(1) << (index - 1))))
+        {
+            return std::nullopt;
+        }
+
+        return index - 1;
+    }
+
+    std::optional<std::string_view> Library::getMapKeyValue(nstd::observer_ptr<IEdict> entity,
+                                                            std::string_view key) const
+    {
+        return m_keyValueStore->find(entity->getIndex(), key);
+    }
+
+    std::vector<std::pair<std::string_view, std::string_view>>
+        Library::getMapKeyValues(nstd::observer_ptr<IEdict> entity) const
+    {
+        return m_keyValueStore->getAll(entity->getIndex());
+    }
+
+    void Library::addMapKeyValue(nstd::observer_ptr<IEdict> entity, std::string_view key, std::string_view value)
+    {
+        m_keyValueStore->add(entity->getIndex(), key, value);
+    }
+
+    edict_t *Library::_getTempEntityProbe()
+    {
+        // Slot of the removed probe can be taken by another entity
+        if (auto probe = getEdict(m_tempEntityProbe); probe)
+        {
+            return static_cast<edict_t *>(*probe);
+        }
+
+        edict_t *probe = m_origEngineFuncs->pfnCreateEntity();
+        if (!probe)
+        {
+            return nullptr;
+        }
+
+        // Engine finds the touched leafs only for entities with a model, the world model is always present
+        probe->v.modelindex = 1;
+        probe->v.effects |= EF_NODRAW;
+        probe->v.solid = SOLID_NOT;
+        probe->v.movetype = MOVETYPE_NONE;
+        m_tempEntityProbe = getEdictHandle(getEdict(probe));
+
+        return probe;
+    }
+
+    bool Library::_cullSound(std::uint32_t entity,
+                             const std::array<float, 3> &origin,
+                             Channel channel,
+                             std::string_view sample,
+                             float volume,
+                             float attenuation,
+                             SoundFlags fFlags,
+                             Pitch pitch) const
+    {
+        const auto &soundCuller = gAnubisApi->getSoundCuller();
+        if (!soundCuller->isEnabled())
+        {
+            return false;
+        }
+
+        // Time does not change within the frame, listeners are gathered once from players seen in it
+        if (soundCuller->startFrame(m_engineGlobals->time))
+        {
+            _takeVisibilitySets();
+
+            ClientsMask players = m_visibilityCache->getPlayers();
+            for (std::uint32_t i = 0; players; i++, players >>= 1)
+            {
+                auto client = static_cast<::IGameClient *>(*m_gameClients[i]);
+                if (!(players & 1) || client->IsFakeClient())
+                {
+                    continue;
+                }
+
+                if (client->IsProxy())
+                {
+                    soundCuller->addGlobalListener();
+                    continue;
+                }
+
+                soundCuller->addListener(m_visibilityCache->getViewOrigin(i));
+            }
+        }
+
+        return soundCuller->cull(entity, origin, channel, sample, volume, attenuation, fFlags, pitch);
+    }
+
+    ModelIndex Library::_modelIndex(std::string_view model) const
+    {
+        if (auto cachedId = gAnubisApi->getPrecacheManager()->find(PrecacheType::Model, model); cachedId)
+        {
+            return ModelIndex(cachedId->value);
+        }
+
+        return ModelIndex(m_origEngineFuncs->pfnModelIndex(model.data()));
     }
 } // namespace Anubis::Engine
@@ -35,6 +35,11 @@ class IRehldsApi;
 #include "GameClient.hpp"
 #include "Hooks.hpp"
 #include "Cvar.hpp"
+#include "ClientInfo.hpp"
+#include "MsgScheduler.hpp"
+#include "TempEntityBatch.hpp"
+#include "VisibilityCache.hpp"
+#include "KeyValueStore.hpp"
 
 #include <rehlds_api.h>
 #include <engine_hlds_api.h>
@@ -231,10 +236,70 @@ namespace Anubis::Engine
         void removeHooks() final;
         void initPlayerEdicts();
 
+        [[nodiscard]] EdictHandle getEdictHandle(nstd::observer_ptr<IEdict> edict) const final;
+        [[nodiscard]] bool isValidHandle(EdictHandle handle) const final;
+        [[nodiscard]] nstd::observer_ptr<IEdict> getEdict(EdictHandle handle) const final;
+        void invalidateEdict(const edict_t *edict) final;
+        void invalidateEdicts() final;
+        [[nodiscard]] EdictsRange getEdictsInUse() const final;
+        [[nodiscard]] nstd::observer_ptr<IClientInfo> getClientInfo(nstd::observer_ptr<IEdict> player) const final;
+        void updateClientInfo(nstd::observer_ptr<IEdict> player) final;
+        void clearClientInfo(nstd::observer_ptr<IEdict> player) final;
+        void dropClient(nstd::observer_ptr<IGameClient> client, std::string_view reason) final;
+        [[nodiscard]] std::unique_ptr<IMsgBuilder> createMsgBuilder(MsgType msgType) const final;
+        std::uint32_t multicastMsg(const IMsgBuilder &msg, ClientsMask clients, bool reliable) const final;
+        std::uint32_t
+            queueMsg(const IMsgBuilder &msg, ClientsMask clients, MsgPriority priority, std::uint32_t channel) final;
+        [[nodiscard]] MsgQueueStats getMsgQueueStats(nstd::observer_ptr<IGameClient> client) const final;
+        void emitTempEntity(const TempEntityEvent &event, TempEntityRoute route, ClientsMask clients) final;
+        [[nodiscard]] bool isInPotentialSet(nstd::observer_ptr<IEdict> player,
+                                            nstd::observer_ptr<IEdict> entity,
+                                            PotentialSet set) final;
+        [[nodiscard]] ClientsMask getPlayersInPotentialSet(nstd::observer_ptr<IEdict> player, PotentialSet set) final;
+        [[nodiscard]] std::optional<std::string_view> getMapKeyValue(nstd::observer_ptr<IEdict> entity,
+                                                                     std::string_view key) const final;
+        [[nodiscard]] std::vector<std::pair<std::string_view, std::string_view>>
+            getMapKeyValues(nstd::observer_ptr<IEdict> entity) const final;
+
+        /* Used only by the core, plugins see the overridden arguments through cmdArgs(), cmdArgv() and cmdArgc() */
+        void overrideCmdArgs(std::string_view cmd, std::string_view args);
+        void clearCmdArgsOverride();
+
+        /* Used only by the core to flush the queues at the start of the frame and drop them on disconnect */
+        void sendQueuedMsgs(float time);
+        void clearMsgQueue(nstd::observer_ptr<IGameClient> client);
+
+        /* Used only by the core to send temporary entities at the start of the frame and drop them on map change */
+        void sendTempEntities();
+        void clearTempEntities();
+
+        /* Used only by the core at the start of the frame, sets of players are taken again on the first use */
+        void invalidateVisibility();
+
+        /* Used only by the core to store key values of map entities while the map is loading */
+        void addMapKeyValue(nstd::observer_ptr<IEdict> entity, std::string_view key, std::string_view value);
+
+    private:
+        /* Same as MAX_ARGS in the engine */
+        static constexpr std::size_t MAX_CMD_ARGS = 80;
+
     private:
         void _initGameClients();
         void _replaceFuncs();
         nstd::observer_ptr<const RehldsFuncs_t> _initReHLDSAPI();
+        [[nodiscard]] ModelIndex _modelIndex(std::string_view model) const;
+        edict_t *_getTempEntityProbe();
+        void _takeVisibilitySets() const;
+        void _checkPlayersVisibility();
+        [[nodiscard]] std::optional<std::uint32_t> _getVisibilitySlot(nstd::observer_ptr<IEdict> player);
+        [[nodiscard]] bool _cullSound(std::uint32_t entity,
+                                      const std::array<float, 3> &origin,
+                                      Channel channel,
+                                      std::string_view sample,
+                                      float volume,
+                                      float attenuation,
+                                      SoundFlags fFlags,
+                                      Pitch pitch) const;
 
     private:
         std::unique_ptr<enginefuncs_t> m_engineFuncs;
@@ -248,9 +313,23 @@ namespace Anubis::Engine
         nstd::observer_ptr<IRehldsServerStatic> m_reServerStatic;
         std::unique_ptr<Hooks> m_hooks;
         std::array<std::uint32_t, 2> m_rehldsVersion = {0u, 0u};
-        std::unordered_map<std::uint32_t, std::unique_ptr<IEdict>> m_edicts;
+        std::vector<std::unique_ptr<IEdict>> m_edicts;
+        std::array<std::uint32_t, EDICTS_LIMIT> m_edictsGeneration;
+        std::array<std::uint32_t, EDICTS_LIMIT / 32> m_edictsInUse;
         std::unordered_map<std::string, std::unique_ptr<ICvar>> m_cvars;
         std::unordered_map<std::string, ServerCmdCallback> m_srvCmds;
         std::vector<std::unique_ptr<IGameClient>> m_gameClients;
+        std::vector<std::unique_ptr<ClientInfo>> m_clientsInfo;
+        std::unique_ptr<MsgScheduler> m_msgScheduler;
+        std::unique_ptr<TempEntityBatch> m_tempEntityBatch;
+        EdictHandle m_tempEntityProbe = INVALID_EDICT_HANDLE;
+        std::vector<ClientsMask> m_tempEntityReceivers;
+        std::vector<std::byte> m_tempEntityData;
+        std::unique_ptr<VisibilityCache> m_visibilityCache;
+        std::array<unsigned char *, 2> m_engineSets = {nullptr, nullptr}; // static buffers of SetFatPVS and SetFatPAS
+        std::unique_ptr<KeyValueStore> m_keyValueStore;
+        bool m_cmdArgsOverridden = false;
+        std::string m_cmdArgsOverride;
+        std::vector<std::string> m_cmdArgvOverride;
     };
 } // namespace Anubis::Engine
@@ -0,0 +1,151 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "MsgBuilder.hpp"
+
+#include <cstring>
+
+namespace Anubis::Engine
+{
+    MsgBuilder::MsgBuilder(MsgType msgType, MsgSize msgSize)
+        : m_type(msgType),
+          m_size(msgSize)
+    {
+        bool isUserMsg = msgType.value >= FIRST_USER_MSG;
+
+        m_argsPos = (isUserMsg && msgSize.value == -1) ? 2 : 1;
+        m_maxSize = m_argsPos + (isUserMsg ? MAX_USER_MSG_DATA : MAX_MSG_DATA - 1);
+        m_data[0] = static_cast<std::byte>(msgType.value);
+        clear();
+    }
+
+    MsgType MsgBuilder::getType() const
+    {
+        return m_type;
+    }
+
+    bool MsgBuilder::isValid() const
+    {
+        if (m_overflowed)
+        {
+            return false;
+        }
+
+        return m_type.value < FIRST_USER_MSG || m_size.value == -1 ||
+               m_dataSize - m_argsPos == static_cast<std::size_t>(m_size.value);
+    }
+
+    const std::byte *MsgBuilder::getData() const
+    {
+        return m_data.data();
+    }
+
+    std::size_t MsgBuilder::getSize() const
+    {
+        return m_dataSize;
+    }
+
+    void MsgBuilder::clear()
+    {
+        m_dataSize = m_argsPos;
+        m_overflowed = false;
+
+        if (m_argsPos == 2)
+        {
+            m_data[1] = std::byte {0};
+        }
+    }
+
+    void MsgBuilder::writeByte(std::byte byteArg)
+    {
+        _write(std::to_integer<std::uint32_t>(byteArg), 1);
+    }
+
+    void MsgBuilder::writeChar(char charArg)
+    {
+        _write(static_cast<std::uint8_t>(charArg), 1);
+    }
+
+    void MsgBuilder::writeShort(std::int16_t shortArg)
+    {
+        _write(static_cast<std::uint16_t>(shortArg), 2);
+    }
+
+    void MsgBuilder::writeLong(std::int32_t longArg)
+    {
+        _write(static_cast<std::uint32_t>(longArg), 4);
+    }
+
+    void MsgBuilder::writeEntity(MsgEntity entArg)
+    {
+        _write(static_cast<std::uint16_t>(entArg.value), 2);
+    }
+
+    void MsgBuilder::writeAngle(MsgAngle angleArg)
+    {
+        _write(static_cast<std::uint32_t>(static_cast<std::int64_t>(angleArg.value * 256.0 / 360.0) & 0xFF), 1);
+    }
+
+    void MsgBuilder::writeCoord(MsgCoord coordArg)
+    {
+        _write(static_cast<std::uint16_t>(static_cast<std::int32_t>(coordArg.value * 8.0f)), 2);
+    }
+
+    void MsgBuilder::writeString(std::string_view strArg)
+    {
+        if (!_reserve(strArg.length() + 1))
+        {
+            return;
+        }
+
+        std::memcpy(m_data.data() + m_dataSize, strArg.data(), strArg.length());
+        m_dataSize += strArg.length();
+        m_data[m_dataSize++] = std::byte {0};
+    }
+
+    void MsgBuilder::_write(std::uint32_t value, std::size_t bytesNum)
+    {
+        if (!_reserve(bytesNum))
+        {
+            return;
+        }
+
+        // Little endian like the rest of the protocol
+        for (std::size_t i = 0; i < bytesNum; i++)
+        {
+            m_data[m_dataSize++] = static_cast<std::byte>(value >> (i * 8));
+        }
+    }
+
+    bool MsgBuilder::_reserve(std::size_t bytesNum)
+    {
+        if (m_overflowed || m_dataSize + bytesNum > m_maxSize)
+        {
+            m_overflowed = true;
+            return false;
+        }
+
+        if (m_argsPos == 2)
+        {
+            m_data[1] = static_cast<std::byte>(m_dataSize + bytesNum - m_argsPos);
+        }
+
+        return true;
+    }
+} // namespace Anubis::Engine
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <engine/IMsgBuilder.hpp>
+
+#include <array>
+
+namespace Anubis::Engine
+{
+    class MsgBuilder final : public IMsgBuilder
+    {
+    public:
+        /* Same as svc_startofusermsgs in the engine */
+        static constexpr std::uint8_t FIRST_USER_MSG = 64;
+
+        /* Same as MAX_USER_MSG_DATA in the engine */
+        static constexpr std::size_t MAX_USER_MSG_DATA = 192;
+
+        /* Same as size of the message buffer in the engine */
+        static constexpr std::size_t MAX_MSG_DATA = 512;
+
+    public:
+        MsgBuilder(MsgType msgType, MsgSize msgSize);
+        ~MsgBuilder() final = default;
+
+        [[nodiscard]] MsgType getType() const final;
+        [[nodiscard]] bool isValid() const final;
+        [[nodiscard]] const std::byte *getData() const final;
+        [[nodiscard]] std::size_t getSize() const final;
+        void clear() final;
+
+        void writeByte(std::byte byteArg) final;
+        void writeChar(char charArg) final;
+        void writeShort(std::int16_t shortArg) final;
+        void writeLong(std::int32_t longArg) final;
+        void writeEntity(MsgEntity entArg) final;
+        void writeAngle(MsgAngle angleArg) final;
+        void writeCoord(MsgCoord coordArg) final;
+        void writeString(std::string_view strArg) final;
+
+    private:
+        void _write(std::uint32_t value, std::size_t bytesNum);
+        [[nodiscard]] bool _reserve(std::size_t bytesNum);
+
+    private:
+        MsgType m_type;
+        MsgSize m_size;        // registered size of the user message
+        std::size_t m_argsPos; // arguments start after the type and the length of variable sized user message
+        std::size_t m_maxSize;
+        std::size_t m_dataSize = 0;
+        bool m_overflowed = false;
+        std::array<std::byte, MAX_MSG_DATA + 2> m_data {};
+    };
+} // namespace Anubis::Engine
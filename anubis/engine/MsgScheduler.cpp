@@ -0,0 +1,229 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "MsgScheduler.hpp"
+
+#include <algorithm>
+
+namespace Anubis::Engine
+{
+    MsgScheduler::MsgScheduler(std::uint32_t slotsNum) : m_queues(slotsNum) {}
+
+    bool MsgScheduler::push(std::uint32_t slot, const IMsgBuilder &msg, MsgPriority priority, std::uint32_t channel)
+    {
+        auto &queue = m_queues[slot];
+
+        std::optional<MsgPos> superseded;
+        if (channel)
+        {
+            superseded = _findSuperseded(queue, msg.getType(), channel);
+        }
+
+        if (!_makeRoom(queue, msg.getSize(), priority, superseded))
+        {
+            queue.stats.droppedNum++;
+            return false;
+        }
+
+        QueuedMsg queuedMsg {std::vector<std::byte>(msg.getData(), msg.getData() + msg.getSize()), msg.getType(),
+                             channel};
+        auto &msgs = queue.msgs[static_cast<std::size_t>(priority)];
+        queue.bytes += msg.getSize();
+
+        if (!superseded)
+        {
+            msgs.push_back(std::move(queuedMsg));
+            return true;
+        }
+
+        auto &supersededMsgs = queue.msgs[superseded->priority];
+        queue.bytes -= supersededMsgs[superseded->index].data.size();
+        queue.stats.coalescedNum++;
+
+        // Replacement takes the place of the superseded message unless it goes to another priority
+        if (&supersededMsgs == &msgs)
+        {
+            msgs[superseded->index] = std::move(queuedMsg);
+        }
+        else
+        {
+            supersededMsgs.erase(supersededMsgs.begin() + static_cast<std::ptrdiff_t>(superseded->index));
+            msgs.push_back(std::move(queuedMsg));
+        }
+
+        return true;
+    }
+
+    void MsgScheduler::send(std::uint32_t slot,
+                            float time,
+                            float rate,
+                            std::size_t freeSpace,
+                            const WriteCallback &write)
+    {
+        auto &queue = m_queues[slot];
+
+        // Time goes back on map change
+        float elapsed = std::clamp(time - queue.lastTime, 0.0f, MAX_BURST_TIME);
+        float share = rate * RATE_SHARE;
+
+        queue.lastTime = time;
+        queue.tokens = std::min(queue.tokens + share * elapsed, share * MAX_BURST_TIME);
+
+        // Highest priority first, the message which does not fit stops sending to keep the order
+        for (auto msgs = queue.msgs.rbegin(); msgs != queue.msgs.rend(); ++msgs)
+        {
+            while (!msgs->empty() && queue.tokens > 0.0f)
+            {
+                const auto &data = msgs->front().data;
+                if (data.size() > freeSpace)
+                {
+                    return;
+                }
+
+                write(data.data(), data.size());
+
+                freeSpace -= data.size();
+                queue.tokens -= static_cast<float>(data.size());
+                queue.bytes -= data.size();
+                queue.stats.sentNum++;
+                msgs->pop_front();
+            }
+        }
+    }
+
+    void MsgScheduler::clear(std::uint32_t slot)
+    {
+        auto &queue = m_queues[slot];
+
+        for (auto &msgs : queue.msgs)
+        {
+            msgs.clear();
+        }
+
+        queue.bytes = 0;
+        queue.tokens = 0.0f;
+        queue.stats = {};
+    }
+
+    bool MsgScheduler::isEmpty(std::uint32_t slot) const
+    {
+        return !m_queues[slot].bytes;
+    }
+
+    MsgQueueStats MsgScheduler::getStats(std::uint32_t slot) const
+    {
+        const auto &queue = m_queues[slot];
+
+        MsgQueueStats stats = queue.stats;
+        stats.queuedBytes = queue.bytes;
+
+        for (const auto &msgs : queue.msgs)
+        {
+            stats.queuedNum += msgs.size();
+        }
+
+        return stats;
+    }
+
+    std::optional<MsgScheduler::MsgPos> MsgScheduler::_findSuperseded(const Queue &queue,
+                                                                      MsgType type,
+                                                                      std::uint32_t channel)
+    {
+        for (std::size_t i = 0; i < queue.msgs.size(); i++)
+        {
+            const auto &msgs = queue.msgs[i];
+            auto it = std::find_if(msgs.cbegin(), msgs.cend(),
+                                   [type, channel](const QueuedMsg &msg)
+                                   {
+                                       return msg.channel == channel && msg.type == type;
+                                   });
+
+            if (it != msgs.cend())
+            {
+                return MsgPos {i, static_cast<std::size_t>(it - msgs.cbegin())};
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    bool MsgScheduler::_makeRoom(Queue &queue,
+                                 std::size_t size,
+                                 MsgPriority priority,
+                                 std::optional<MsgPos> &superseded)
+    {
+        std::size_t freed = superseded ? queue.msgs[superseded->priority][superseded->index].data.size() : 0;
+        auto isFull = [&queue, size, freed]()
+        {
+            return queue.bytes - freed + size > MAX_QUEUED_BYTES;
+        };
+
+        if (!isFull())
+        {
+            return true;
+        }
+
+        // Nothing is dropped if even dropping all messages which may be dropped would not make room
+        std::size_t droppable = 0;
+        for (std::size_t i = 0; i <= static_cast<std::size_t>(priority); i++)
+        {
+            for (const auto &msg : queue.msgs[i])
+            {
+                droppable += msg.data.size();
+            }
+        }
+
+        if (superseded && superseded->priority <= static_cast<std::size_t>(priority))
+        {
+            droppable -= freed;
+        }
+
+        if (queue.bytes - freed - droppable + size > MAX_QUEUED_BYTES)
+        {
+            return false;
+        }
+
+        // The oldest messages of the lowest priority are dropped first, never those of higher priority
+        for (std::size_t i = 0; i <= static_cast<std::size_t>(priority) && isFull(); i++)
+        {
+            auto &msgs = queue.msgs[i];
+            bool hasSuperseded = superseded && superseded->priority == i;
+
+            for (std::size_t j = 0; j < msgs.size() && isFull();)
+            {
+                if (hasSuperseded && superseded->index == j)
+                {
+                    j++;
+                    continue;
+                }
+
+                queue.bytes -= msgs[j].data.size();
+                queue.stats.droppedNum++;
+                msgs.erase(msgs.begin() + static_cast<std::ptrdiff_t>(j));
+
+                if (hasSuperseded && j < superseded->index)
+                {
+                    superseded->index--;
+                }
+            }
+        }
+
+        return true;
+    }
+} // namespace Anubis::Engine
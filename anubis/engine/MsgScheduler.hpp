@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <engine/IMsgBuilder.hpp>
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace Anubis::Engine
+{
+    /* Per-client queues of reliable messages sent by plugins.
+     * Messages are sent by priority as the client's rate and free space of its reliable buffer allow. */
+    class MsgScheduler
+    {
+    public:
+        using WriteCallback = std::function<void(const std::byte *data, std::size_t size)>;
+
+    public:
+        /* Size of messages queued per client */
+        static constexpr std::size_t MAX_QUEUED_BYTES = 16384;
+
+        /* Part of the client's rate available for queued messages */
+        static constexpr float RATE_SHARE = 0.25f;
+
+        /* Time for which unused rate is saved up */
+        static constexpr float MAX_BURST_TIME = 0.2f;
+
+    public:
+        explicit MsgScheduler(std::uint32_t slotsNum);
+
+        /* Returns false if the message has been dropped */
+        bool push(std::uint32_t slot, const IMsgBuilder &msg, MsgPriority priority, std::uint32_t channel);
+        void send(std::uint32_t slot, float time, float rate, std::size_t freeSpace, const WriteCallback &write);
+
+        /* Forgets queued messages and statistics, the slot is taken by a new client next */
+        void clear(std::uint32_t slot);
+        [[nodiscard]] bool isEmpty(std::uint32_t slot) const;
+        [[nodiscard]] MsgQueueStats getStats(std::uint32_t slot) const;
+
+    private:
+        struct QueuedMsg
+        {
+            std::vector<std::byte> data;
+            MsgType type;
+            std::uint32_t channel;
+        };
+
+        struct Queue
+        {
+            std::array<std::deque<QueuedMsg>, 3> msgs; // indexed by priority
+            std::size_t bytes = 0;
+            float tokens = 0.0f;
+            float lastTime = 0.0f;
+            MsgQueueStats stats;
+        };
+
+        struct MsgPos
+        {
+            std::size_t priority;
+            std::size_t index;
+        };
+
+    private:
+        [[nodiscard]] static std::optional<MsgPos> _findSuperseded(const Queue &queue,
+                                                                   MsgType type,
+                                                                   std::uint32_t channel);
+
+        /* Superseded message is kept and its bytes count as free, its position is updated if messages are dropped */
+        [[nodiscard]] bool _makeRoom(Queue &queue,
+                                     std::size_t size,
+                                     MsgPriority priority,
+                                     std::optional<MsgPos> &superseded);
+
+    private:
+        std::vector<Queue> m_queues;
+    };
+} // namespace Anubis::Engine
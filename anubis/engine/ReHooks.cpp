@@ -23,6 +23,7 @@
 #include "GameClient.hpp"
 #include "Cvar.hpp"
 #include "Hooks.hpp"
+#include "Callbacks.hpp"
 
 namespace Anubis::Engine::ReHooks
 {
@@ -42,6 +43,12 @@ namespace Anubis::Engine::ReHooks
                 chain->callOriginal(static_cast<::IGameClient *>(*client), crash, string.data());
             },
             gameClient, crash, string);
+
+        gAnubisApi->getPlayerStorage()->resetSlot(gameClient->getEdict()->getIndex());
+        gAnubisApi->getCmdLimiter()->resetSlot(gameClient->getEdict()->getIndex());
+        gAnubisApi->getCvarQueries()->resetSlot(gameClient->getEdict()->getIndex());
+        Callbacks::GameDLL::getEngine()->clearMsgQueue(gameClient);
+        gAnubisApi->getEngine()->clearClientInfo(gameClient->getEdict());
     }
 
     void Cvar_DirectSetHook(IRehldsHook_Cvar_DirectSet *chain, cvar_t *cvar, const char *value)
@@ -81,4 +88,26 @@ namespace Anubis::Engine::ReHooks
                 return engineLib->getEdict(edict);
             }));
     }
+
+    void ED_Free(IRehldsHook_ED_Free *chain, edict_t *edict)
+    {
+        static auto engineLib = gAnubisApi->getEngine();
+        static auto hookChain = engineLib->getHooks()->edFree();
+
+        hookChain->callChain(
+            [chain](nstd::observer_ptr<IEdict> edict)
+            {
+                chain->callNext(static_cast<edict_t *>(*edict));
+            },
+            [chain](nstd::observer_ptr<IEdict> edict)
+            {
+                chain->callOriginal(static_cast<edict_t *>(*edict));
+            },
+            engineLib->getEdict(edict));
+
+        if (edict->free)
+        {
+            engineLib->invalidateEdict(edict);
+        }
+    }
 } // namespace Anubis::Engine::ReHooks
@@ -30,4 +30,5 @@ namespace Anubis::Engine::ReHooks
     void SV_DropClientHook(IRehldsHook_SV_DropClient *chain, ::IGameClient *client, bool crash, const char *string);
     void Cvar_DirectSetHook(IRehldsHook_Cvar_DirectSet *chain, cvar_t *cvar, const char *value);
     edict_t *ED_Alloc(IRehldsHook_ED_Alloc *chain);
+    void ED_Free(IRehldsHook_ED_Free *chain, edict_t *edict);
 } // namespace Anubis::Engine::ReHooks
\ No newline at end of file
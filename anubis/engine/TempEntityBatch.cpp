@@ -0,0 +1,184 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "TempEntityBatch.hpp"
+#include "MsgBuilder.hpp"
+
+#include <cstring>
+#include <initializer_list>
+
+namespace Anubis::Engine
+{
+    namespace
+    {
+        /* Same as TE_* in the engine */
+        enum TempEntityType : std::uint8_t
+        {
+            TE_BEAMPOINTS = 0,
+            TE_EXPLOSION = 3,
+            TE_SMOKE = 5,
+            TE_TRACER = 6,
+            TE_SPARKS = 9,
+            TE_SPRITE = 17,
+            TE_BEAMCYLINDER = 21,
+            TE_DLIGHT = 27
+        };
+
+        void writeVector(MsgBuilder &msg, const TempEntity::Vector &vector)
+        {
+            msg.writeCoord(MsgCoord(vector[0]));
+            msg.writeCoord(MsgCoord(vector[1]));
+            msg.writeCoord(MsgCoord(vector[2]));
+        }
+
+        void writeBytes(MsgBuilder &msg, std::initializer_list<std::uint8_t> bytes)
+        {
+            for (std::uint8_t byte : bytes)
+            {
+                msg.writeByte(static_cast<std::byte>(byte));
+            }
+        }
+
+        void writeSprite(MsgBuilder &msg, PrecacheId sprite)
+        {
+            msg.writeShort(static_cast<std::int16_t>(sprite.value));
+        }
+
+        void writeType(MsgBuilder &msg, TempEntityType type)
+        {
+            msg.writeByte(static_cast<std::byte>(type));
+        }
+
+        TempEntity::Vector encode(MsgBuilder &msg, const TempEntity::BeamPoints &beam)
+        {
+            writeType(msg, TE_BEAMPOINTS);
+            writeVector(msg, beam.start);
+            writeVector(msg, beam.end);
+            writeSprite(msg, beam.sprite);
+            writeBytes(msg, {beam.startFrame, beam.frameRate, beam.life, beam.width, beam.noise, beam.color.r,
+                             beam.color.g, beam.color.b, beam.brightness, beam.speed});
+            return beam.start;
+        }
+
+        TempEntity::Vector encode(MsgBuilder &msg, const TempEntity::Explosion &explosion)
+        {
+            writeType(msg, TE_EXPLOSION);
+            writeVector(msg, explosion.origin);
+            writeSprite(msg, explosion.sprite);
+            writeBytes(msg, {explosion.scale, explosion.frameRate, explosion.flags});
+            return explosion.origin;
+        }
+
+        TempEntity::Vector encode(MsgBuilder &msg, const TempEntity::Smoke &smoke)
+        {
+            writeType(msg, TE_SMOKE);
+            writeVector(msg, smoke.origin);
+            writeSprite(msg, smoke.sprite);
+            writeBytes(msg, {smoke.scale, smoke.frameRate});
+            return smoke.origin;
+        }
+
+        TempEntity::Vector encode(MsgBuilder &msg, const TempEntity::Tracer &tracer)
+        {
+            writeType(msg, TE_TRACER);
+            writeVector(msg, tracer.start);
+            writeVector(msg, tracer.end);
+            return tracer.start;
+        }
+
+        TempEntity::Vector encode(MsgBuilder &msg, const TempEntity::Sparks &sparks)
+        {
+            writeType(msg, TE_SPARKS);
+            writeVector(msg, sparks.origin);
+            return sparks.origin;
+        }
+
+        TempEntity::Vector encode(MsgBuilder &msg, const TempEntity::Sprite &sprite)
+        {
+            writeType(msg, TE_SPRITE);
+            writeVector(msg, sprite.origin);
+            writeSprite(msg, sprite.sprite);
+            writeBytes(msg, {sprite.scale, sprite.brightness});
+            return sprite.origin;
+        }
+
+        TempEntity::Vector encode(MsgBuilder &msg, const TempEntity::BeamCylinder &cylinder)
+        {
+            writeType(msg, TE_BEAMCYLINDER);
+            writeVector(msg, cylinder.center);
+
+            // Axis and radius are sent as the point above the center
+            writeVector(msg, {cylinder.center[0], cylinder.center[1], cylinder.center[2] + cylinder.radius});
+            writeSprite(msg, cylinder.sprite);
+            writeBytes(msg, {cylinder.startFrame, cylinder.frameRate, cylinder.life, cylinder.width, cylinder.noise,
+                             cylinder.color.r, cylinder.color.g, cylinder.color.b, cylinder.brightness,
+                             cylinder.speed});
+            return cylinder.center;
+        }
+
+        TempEntity::Vector encode(MsgBuilder &msg, const TempEntity::DLight &light)
+        {
+            writeType(msg, TE_DLIGHT);
+            writeVector(msg, light.origin);
+            writeBytes(msg, {light.radius, light.color.r, light.color.g, light.color.b, light.life, light.decayRate});
+            return light.origin;
+        }
+    } // namespace
+
+    void TempEntityBatch::push(const TempEntityEvent &event, TempEntityRoute route, ClientsMask clients)
+    {
+        MsgBuilder msg(MsgType(SVC_TEMPENTITY), MsgSize(-1));
+        TempEntity::Vector origin = std::visit(
+            [&msg](const auto &tempEntity)
+            {
+                return encode(msg, tempEntity);
+            },
+            event);
+
+        m_events.push_back({origin, route, clients, m_data.size(), msg.getSize()});
+        m_data.insert(m_data.end(), msg.getData(), msg.getData() + msg.getSize());
+    }
+
+    std::size_t TempEntityBatch::assemble(std::uint32_t client,
+                                          const std::vector<ClientsMask> &receivers,
+                                          std::byte *buffer,
+                                          std::size_t size) const
+    {
+        std::size_t written = 0;
+        for (std::size_t i = 0; i < m_events.size(); i++)
+        {
+            const Event &event = m_events[i];
+            if (!(receivers[i] & (ClientsMask(1) << client)) || written + event.size > size)
+            {
+                continue;
+            }
+
+            std::memcpy(buffer + written, m_data.data() + event.offset, event.size);
+            written += event.size;
+        }
+
+        return written;
+    }
+
+    void TempEntityBatch::clear()
+    {
+        m_events.clear();
+        m_data.clear();
+    }
+} // namespace Anubis::Engine
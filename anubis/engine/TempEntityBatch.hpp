@@ -0,0 +1,70 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <engine/IMsgBuilder.hpp>
+#include <engine/TempEntity.hpp>
+
+#include <vector>
+
+namespace Anubis::Engine
+{
+    /* Temporary entities emitted during the frame, each one encoded once as a whole svc_temp_entity message */
+    class TempEntityBatch
+    {
+    public:
+        /* Same as svc_temp_entity in the engine */
+        static constexpr std::uint8_t SVC_TEMPENTITY = 23;
+
+        struct Event
+        {
+            TempEntity::Vector origin;
+            TempEntityRoute route;
+            ClientsMask clients;
+            std::size_t offset;
+            std::size_t size;
+        };
+
+    public:
+        void push(const TempEntityEvent &event, TempEntityRoute route, ClientsMask clients);
+
+        /* Copies events received by the client into the buffer, events which do not fit are skipped */
+        std::size_t assemble(std::uint32_t client,
+                             const std::vector<ClientsMask> &receivers,
+                             std::byte *buffer,
+                             std::size_t size) const;
+
+        [[nodiscard]] const std::vector<Event> &getEvents() const
+        {
+            return m_events;
+        }
+
+        [[nodiscard]] bool isEmpty() const
+        {
+            return m_events.empty();
+        }
+
+        void clear();
+
+    private:
+        std::vector<Event> m_events;
+        std::vector<std::byte> m_data;
+    };
+} // namespace Anubis::Engine
@@ -0,0 +1,120 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "VisibilityCache.hpp"
+
+#include <algorithm>
+
+namespace Anubis::Engine
+{
+    VisibilityCache::VisibilityCache(std::uint32_t slotsNum)
+        : m_sets(slotsNum * 2 * SET_SIZE),
+          m_spareSets(2 * SET_SIZE),
+          m_viewOrigins(slotsNum),
+          m_visiblePlayers(slotsNum * 2),
+          m_checkedEntities(slotsNum * 2 * ENTITY_WORDS),
+          m_visibleEntities(slotsNum * 2 * ENTITY_WORDS)
+    {
+    }
+
+    void VisibilityCache::reset()
+    {
+        // Only rows of players added in the frame could have been filled
+        for (std::uint32_t slot = 0; m_players; slot++, m_players >>= 1)
+        {
+            if (!(m_players & 1))
+            {
+                continue;
+            }
+
+            std::size_t row = _getRow(slot, PotentialSet::PVS);
+            std::fill_n(m_checkedEntities.begin() + row * ENTITY_WORDS, ENTITY_WORDS * 2, 0);
+            m_visiblePlayers[row] = 0;
+            m_visiblePlayers[row + 1] = 0;
+        }
+
+        m_setsTaken = false;
+        m_playersChecked = false;
+    }
+
+    void VisibilityCache::addPlayer(std::uint32_t slot, const std::array<float, 3> &viewOrigin)
+    {
+        m_viewOrigins[slot] = viewOrigin;
+        m_players |= ClientsMask(1) << slot;
+    }
+
+    unsigned char *VisibilityCache::getSet(std::uint32_t slot, PotentialSet set)
+    {
+        return m_sets.data() + _getRow(slot, set) * SET_SIZE;
+    }
+
+    unsigned char *VisibilityCache::getSpareSet(PotentialSet set)
+    {
+        return m_spareSets.data() + static_cast<std::size_t>(set) * SET_SIZE;
+    }
+
+    void VisibilityCache::setSetsTaken()
+    {
+        m_setsTaken = true;
+    }
+
+    void VisibilityCache::setVisiblePlayers(std::uint32_t slot, PotentialSet set, ClientsMask players)
+    {
+        m_visiblePlayers[_getRow(slot, set)] = players;
+    }
+
+    void VisibilityCache::setPlayersChecked()
+    {
+        m_playersChecked = true;
+    }
+
+    ClientsMask VisibilityCache::getVisiblePlayers(std::uint32_t slot, PotentialSet set) const
+    {
+        return m_visiblePlayers[_getRow(slot, set)];
+    }
+
+    std::optional<bool> VisibilityCache::findEntity(std::uint32_t slot, PotentialSet set, std::uint32_t index) const
+    {
+        std::size_t word = _getRow(slot, set) * ENTITY_WORDS + index / 32;
+        std::uint32_t bit = 1u << (index % 32);
+
+        if (!(m_checkedEntities[word] & bit))
+        {
+            return std::nullopt;
+        }
+
+        return (m_visibleEntities[word] & bit) != 0;
+    }
+
+    void VisibilityCache::setEntity(std::uint32_t slot, PotentialSet set, std::uint32_t index, bool visible)
+    {
+        std::size_t word = _getRow(slot, set) * ENTITY_WORDS + index / 32;
+        std::uint32_t bit = 1u << (index % 32);
+
+        m_checkedEntities[word] |= bit;
+        if (visible)
+        {
+            m_visibleEntities[word] |= bit;
+        }
+        else
+        {
+            m_visibleEntities[word] &= ~bit;
+        }
+    }
+} // namespace Anubis::Engine
@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <engine/Common.hpp>
+#include <engine/IMsgBuilder.hpp>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace Anubis::Engine
+{
+    /* PVS and PAS of players and their visibility of players and entities, valid for a single frame.
+     * Sets are copied once per frame on the first use, players are checked against each other at once on the first
+     * query, entities when they are asked for. */
+    class VisibilityCache
+    {
+    public:
+        /* Same as size of fatpvs and fatpas in the engine */
+        static constexpr std::size_t SET_SIZE = 1024;
+
+    public:
+        explicit VisibilityCache(std::uint32_t slotsNum);
+
+        /* Forgets everything cached, players with sets have to be added again */
+        void reset();
+
+        /* Marks the player as having sets, they have to be copied into buffers returned by getSet() */
+        void addPlayer(std::uint32_t slot, const std::array<float, 3> &viewOrigin);
+        [[nodiscard]] unsigned char *getSet(std::uint32_t slot, PotentialSet set);
+
+        /* Room to keep the engine's own set while sets of players are copied */
+        [[nodiscard]] unsigned char *getSpareSet(PotentialSet set);
+
+        [[nodiscard]] bool areSetsTaken() const
+        {
+            return m_setsTaken;
+        }
+
+        void setSetsTaken();
+
+        [[nodiscard]] const std::array<float, 3> &getViewOrigin(std::uint32_t slot) const
+        {
+            return m_viewOrigins[slot];
+        }
+
+        [[nodiscard]] ClientsMask getPlayers() const
+        {
+            return m_players;
+        }
+
+        [[nodiscard]] bool arePlayersChecked() const
+        {
+            return m_playersChecked;
+        }
+
+        /* Visibility of players is complete once set for all of them */
+        void setVisiblePlayers(std::uint32_t slot, PotentialSet set, ClientsMask players);
+        void setPlayersChecked();
+        [[nodiscard]] ClientsMask getVisiblePlayers(std::uint32_t slot, PotentialSet set) const;
+
+        /* Returns nothing if the entity has not been checked for the player yet */
+        [[nodiscard]] std::optional<bool> findEntity(std::uint32_t slot, PotentialSet set, std::uint32_t index) const;
+        void setEntity(std::uint32_t slot, PotentialSet set, std::uint32_t index, bool visible);
+
+    private:
+        static constexpr std::size_t ENTITY_WORDS = EDICTS_LIMIT / 32;
+
+    private:
+        [[nodiscard]] std::size_t _getRow(std::uint32_t slot, PotentialSet set) const
+        {
+            return slot * 2 + static_cast<std::size_t>(set);
+        }
+
+    private:
+        ClientsMask m_players = 0;
+        bool m_setsTaken = false;
+        bool m_playersChecked = false;
+        std::vector<unsigned char> m_sets;         // PVS and PAS of every player
+        std::vector<unsigned char> m_spareSets;
+        std::vector<std::array<float, 3>> m_viewOrigins;
+        std::vector<ClientsMask> m_visiblePlayers; // players x players bit matrix for both sets
+        std::vector<std::uint32_t> m_checkedEntities;
+        std::vector<std::uint32_t> m_visibleEntities;
+    };
+} // namespace Anubis::Engine
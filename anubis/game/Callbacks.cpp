@@ -19,8 +19,9 @@
 
 #include "Callbacks.hpp"
 
-#include <engine/ILibrary.hpp>
+#include <engine/IClientInfo.hpp>
 #include <Anubis.hpp>
+#include "engine/Library.hpp"
 
 #include <extdll.h>
 #include "Library.hpp"
@@ -41,9 +42,9 @@ namespace Anubis::Game::Callbacks::Engine
         return gameInstance;
     }
 
-    nstd::observer_ptr<::Anubis::Engine::ILibrary> getEngine(nstd::observer_ptr<::Anubis::Engine::ILibrary> eng)
+    nstd::observer_ptr<::Anubis::Engine::Library> getEngine(nstd::observer_ptr<::Anubis::Engine::Library> eng)
     {
-        static nstd::observer_ptr<::Anubis::Engine::ILibrary> engineInstance = eng;
+        static nstd::observer_ptr<::Anubis::Engine::Library> engineInstance = eng;
         return engineInstance;
     }
 
@@ -54,7 +55,16 @@ namespace Anubis::Game::Callbacks::Engine
 
     int pfnSpawn(edict_t *pent)
     {
-        return getGame()->pfnSpawn(getEngine()->getEdict(pent), FuncCallType::Hooks);
+        auto edict = getEngine()->getEdict(pent);
+        int result = getGame()->pfnSpawn(edict, FuncCallType::Hooks);
+
+        // Worldspawn is spawned first, resources can still be precached
+        if (!edict->getIndex())
+        {
+            gAnubisApi->getPrecacheManager()->precacheManifest(getEngine()->getMapName(), getEngine());
+        }
+
+        return result;
     }
 
     qboolean pfnClientConnect(edict_t *pEntity, const char *pszName, const char *pszAddress, char szRejectReason[128])
@@ -68,8 +78,34 @@ namespace Anubis::Game::Callbacks::Engine
         }
         rejectReason.clear();
 
-        if (!getGame()->pfnClientConnect(getEngine()->getEdict(pEntity), pszName, pszAddress, &rejectReason,
-                                         FuncCallType::Hooks))
+        // Floods are rejected before plugins and the game see them
+        bool allowed = gAnubisApi->getConnectLimiter()->check(pszAddress, getEngine()->getTime());
+
+        if (!allowed)
+        {
+            rejectReason = gAnubisApi->getConnectLimiter()->getReason();
+        }
+        else
+        {
+            auto edict = getEngine()->getEdict(pEntity);
+            getEngine()->updateClientInfo(edict);
+
+            const auto &banIndex = gAnubisApi->getBanIndex();
+            auto clientInfo = getEngine()->getClientInfo(edict);
+
+            if (banIndex->isAddressBanned(pszAddress) ||
+                (clientInfo && banIndex->isAuthIDBanned(clientInfo->getAuthID())))
+            {
+                rejectReason = BanIndex::REJECT_REASON;
+                allowed = false;
+            }
+            else
+            {
+                allowed = getGame()->pfnClientConnect(edict, pszName, pszAddress, &rejectReason, FuncCallType::Hooks);
+            }
+        }
+
+        if (!allowed)
         {
 #if defined _WIN32
             strncpy_s(szRejectReason, REASON_REJECT_MAX_LEN, rejectReason.c_str(), _TRUNCATE);
@@ -84,18 +120,36 @@ namespace Anubis::Game::Callbacks::Engine
 
     void pfnClientPutInServer(edict_t *pEntity)
     {
-        getGame()->pfnClientPutInServer(getEngine()->getEdict(pEntity), FuncCallType::Hooks);
+        auto edict = getEngine()->getEdict(pEntity);
+        getEngine()->updateClientInfo(edict);
+        getGame()->pfnClientPutInServer(edict, FuncCallType::Hooks);
     }
 
     void pfnClientCommand(edict_t *pEntity)
     {
-        getGame()->pfnClientCommand(getEngine()->getEdict(pEntity), FuncCallType::Hooks);
+        auto edict = getEngine()->getEdict(pEntity);
+
+        switch (gAnubisApi->getCmdLimiter()->check(edict->getIndex(), getEngine()->cmdArgv(0, FuncCallType::Direct),
+                                                   getEngine()->cmdArgs(FuncCallType::Direct), getEngine()->getTime()))
+        {
+            case CmdLimiter::Verdict::Allow:
+                break;
+            case CmdLimiter::Verdict::Kick:
+                getEngine()->dropClient(getEngine()->getGameClient(edict->getIndex() - 1), "Command flood");
+                return;
+            case CmdLimiter::Verdict::Drop:
+            case CmdLimiter::Verdict::Delay:
+                return;
+        }
+
+        getGame()->pfnClientCommand(edict, FuncCallType::Hooks);
     }
 
     void pfnClientUserInfoChanged(edict_t *pEntity, char *infobuffer)
     {
-        getGame()->pfnClientUserInfoChanged(getEngine()->getEdict(pEntity), ::Anubis::Engine::InfoBuffer(infobuffer),
-                                            FuncCallType::Hooks);
+        auto edict = getEngine()->getEdict(pEntity);
+        getEngine()->updateClientInfo(edict);
+        getGame()->pfnClientUserInfoChanged(edict, ::Anubis::Engine::InfoBuffer(infobuffer), FuncCallType::Hooks);
     }
 
     void pfnServerActivate(edict_t *pEdictList, int edictCount, int clientMax)
@@ -104,16 +158,41 @@ namespace Anubis::Game::Callbacks::Engine
         getGame()->setEdictList(pEdictList);
         getGame()->pfnServerActivate(static_cast<std::uint32_t>(edictCount), static_cast<std::uint32_t>(clientMax),
                                      FuncCallType::Hooks);
+        gAnubisApi->getEntityPools()->fill();
     }
 
     void pfnServerDeactivate()
     {
         getGame()->pfnServerDeactivate(FuncCallType::Hooks);
+        gAnubisApi->getTimers()->cancelMapScoped();
+        gAnubisApi->getPrecacheManager()->endMap(getEngine()->getMapName());
+        getGame()->getTransmitFilterImpl()->clear();
+        gAnubisApi->getPlayerHistory()->clear();
+        gAnubisApi->getEntityPools()->drain();
+        gAnubisApi->getEntityWatcher()->clear();
+        getEngine()->clearTempEntities();
+        getEngine()->invalidateEdicts();
     }
 
     void pfnStartFrame()
     {
+        getEngine()->invalidateVisibility();
+        gAnubisApi->getTimers()->advance(getEngine()->getTime());
+        gAnubisApi->getCvarQueries()->update(getEngine()->getTime());
+        getEngine()->sendQueuedMsgs(getEngine()->getTime());
+        getEngine()->sendTempEntities();
+        gAnubisApi->getCmdLimiter()->runDelayed(getEngine()->getTime(),
+                                                [](std::uint32_t slot, const CmdLimiter::DelayedCmd &cmd)
+                                                {
+                                                    getEngine()->overrideCmdArgs(cmd.name, cmd.args);
+                                                    getGame()->pfnClientCommand(
+                                                        getEngine()->getEdict(slot, FuncCallType::Direct),
+                                                        FuncCallType::Hooks);
+                                                    getEngine()->clearCmdArgsOverride();
+                                                });
+        gAnubisApi->getEntityWatcher()->update();
         getGame()->pfnStartFrame(FuncCallType::Hooks);
+        gAnubisApi->getPlayerHistory()->record(getEngine()->getTime());
     }
 
     void pfnGameShutdown()
@@ -132,12 +211,91 @@ namespace Anubis::Game::Callbacks::Engine
 
     void pfnCvarValue2(const edict_t *pEnt, int requestID, const char *cvarName, const char *value)
     {
+        if (gAnubisApi->getCvarQueries()->handleResponse(getEngine()->getEdict(pEnt),
+                                                         static_cast<std::uint32_t>(requestID), value))
+        {
+            return;
+        }
+
         getGame()->pfnCvarValue2(getEngine()->getEdict(pEnt), static_cast<std::uint32_t>(requestID), cvarName, value,
                                  FuncCallType::Hooks);
     }
 
     void pfnClientDisconnect(edict_t *pEntity)
     {
-        getGame()->pfnClientDisconnect(getEngine()->getEdict(pEntity), FuncCallType::Hooks);
+        auto edict = getEngine()->getEdict(pEntity);
+        getGame()->pfnClientDisconnect(edict, FuncCallType::Hooks);
+        gAnubisApi->getPlayerStorage()->resetSlot(edict->getIndex());
+        gAnubisApi->getCmdLimiter()->resetSlot(edict->getIndex());
+        gAnubisApi->getCvarQueries()->resetSlot(edict->getIndex());
+        getEngine()->clearMsgQueue(getEngine()->getGameClient(edict->getIndex() - 1));
+        getGame()->getTransmitFilterImpl()->clearEntity(edict->getIndex());
+        getGame()->getTransmitFilterImpl()->clearHost(edict->getIndex());
+        getGame()->getUserCmdHistory()->clear(edict->getIndex());
+        getEngine()->invalidateEdict(pEntity);
+        getEngine()->clearClientInfo(edict);
+    }
+
+    int pfnAddToFullPack(entity_state_s *state,
+                         int e,
+                         edict_t *ent,
+                         edict_t *host,
+                         int hostflags,
+                         int player,
+                         unsigned char *pSet)
+    {
+        static auto game = getGame();
+        return game->addToFullPack(state, e, ent, host, hostflags, player, pSet);
+    }
+
+    void pfnCmdStart(const edict_t *player, const usercmd_s *cmd, unsigned int randomSeed)
+    {
+        static auto game = getGame();
+        auto edict = getEngine()->getEdict(player);
+        game->getUserCmdHistory()->record(edict->getIndex(), cmd);
+
+        // Plugins are allowed to alter the command before the game runs it
+        game->pfnCmdStart(edict, ::Anubis::Engine::UserCmd(const_cast<usercmd_s *>(cmd)),
+                          static_cast<std::uint32_t>(randomSeed), FuncCallType::Hooks);
+    }
+
+    void pfnCmdEnd(const edict_t *player)
+    {
+        static auto game = getGame();
+        game->pfnCmdEnd(getEngine()->getEdict(player), FuncCallType::Hooks);
+    }
+
+    void pfnPlayerPreThink(edict_t *pEntity)
+    {
+        static auto game = getGame();
+        game->pfnPlayerPreThink(getEngine()->getEdict(pEntity), FuncCallType::Hooks);
+    }
+
+    void pfnPlayerPostThink(edict_t *pEntity)
+    {
+        static auto game = getGame();
+        game->pfnPlayerPostThink(getEngine()->getEdict(pEntity), FuncCallType::Hooks);
+    }
+
+    void pfnPM_Move(playermove_s *ppmove, qboolean server)
+    {
+        static auto game = getGame();
+        game->pmMove(ppmove, server);
+    }
+
+    void pfnKeyValue(edict_t *pentKeyvalue, KeyValueData *pkvd)
+    {
+        auto edict = getEngine()->getEdict(pentKeyvalue);
+
+        // Map entities are parsed before the server is activated, later key values are not part of the map
+        if (getEngine()->getState() == ::Anubis::Engine::ServerState::Loading)
+        {
+            getEngine()->addMapKeyValue(edict, pkvd->szKeyName, pkvd->szValue);
+        }
+
+        // Null class name is passed through, the game sets only entity variables then
+        std::string_view className = pkvd->szClassName ? std::string_view {pkvd->szClassName} : std::string_view {};
+        pkvd->fHandled =
+            getGame()->pfnKeyValue(edict, className, pkvd->szKeyName, pkvd->szValue, FuncCallType::Hooks) ? 1 : 0;
     }
 } // namespace Anubis::Game::Callbacks::Engine
@@ -23,6 +23,9 @@
 
 typedef int qboolean;
 typedef struct edict_s edict_t;
+struct entity_state_s;
+struct usercmd_s;
+struct playermove_s;
 
 namespace Anubis
 {
@@ -32,14 +35,14 @@ namespace Anubis
     }
     namespace Engine
     {
-        class ILibrary;
+        class Library;
     }
 } // namespace Anubis
 
 namespace Anubis::Game::Callbacks::Engine
 {
     nstd::observer_ptr<Library> getGame(nstd::observer_ptr<Library> game = {});
-    nstd::observer_ptr<::Anubis::Engine::ILibrary> getEngine(nstd::observer_ptr<::Anubis::Engine::ILibrary> eng = {});
+    nstd::observer_ptr<::Anubis::Engine::Library> getEngine(nstd::observer_ptr<::Anubis::Engine::Library> eng = {});
     void pfnGameInit();
     int pfnSpawn(edict_t *pent);
     qboolean pfnClientConnect(edict_t *pEntity, const char *pszName, const char *pszAddress, char szRejectReason[128]);
@@ -53,4 +56,17 @@ namespace Anubis::Game::Callbacks::Engine
     void pfnCvarValue(const edict_t *pEnt, const char *value);
     void pfnCvarValue2(const edict_t *pEnt, int requestID, const char *cvarName, const char *value);
     void pfnClientDisconnect (edict_t *pEntity);
+    int pfnAddToFullPack(entity_state_s *state,
+                         int e,
+                         edict_t *ent,
+                         edict_t *host,
+                         int hostflags,
+                         int player,
+                         unsigned char *pSet);
+    void pfnCmdStart(const edict_t *player, const usercmd_s *cmd, unsigned int randomSeed);
+    void pfnCmdEnd(const edict_t *player);
+    void pfnPlayerPreThink(edict_t *pEntity);
+    void pfnPlayerPostThink(edict_t *pEntity);
+    void pfnPM_Move(playermove_s *ppmove, qboolean server);
+    void pfnKeyValue(edict_t *pentKeyvalue, KeyValueData *pkvd);
 } // namespace Anubis::Game::Callbacks::Engine
\ No newline at end of file
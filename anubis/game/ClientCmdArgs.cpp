@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ClientCmdArgs.hpp"
+
+#include <engine/ILibrary.hpp>
+
+#include <algorithm>
+#include <cctype>
+
+namespace Anubis::Game
+{
+    ClientCmdArgs::ClientCmdArgs(nstd::observer_ptr<Engine::ILibrary> engine) : m_engine(engine)
+    {
+        tokenize();
+    }
+
+    std::uint8_t ClientCmdArgs::getArgc() const
+    {
+        return m_argc;
+    }
+
+    std::string_view ClientCmdArgs::getArgv(std::uint8_t arg) const
+    {
+        return (arg < m_argc) ? m_argv[arg] : std::string_view {};
+    }
+
+    std::string_view ClientCmdArgs::getArgs() const
+    {
+        return m_args;
+    }
+
+    std::uint32_t ClientCmdArgs::getNameHash() const
+    {
+        return m_nameHash;
+    }
+
+    bool ClientCmdArgs::isCmd(std::string_view name) const
+    {
+        if (hashClientCmdName(name) != m_nameHash)
+        {
+            return false;
+        }
+
+        return std::equal(name.cbegin(), name.cend(), m_argv[0].cbegin(), m_argv[0].cend(),
+                          [](char a, char b)
+                          {
+                              return std::tolower(static_cast<unsigned char>(a)) ==
+                                     std::tolower(static_cast<unsigned char>(b));
+                          });
+    }
+
+    void ClientCmdArgs::tokenize()
+    {
+        m_argc = static_cast<std::uint8_t>(
+            std::min<std::size_t>(m_engine->cmdArgc(FuncCallType::Direct), MAX_ARGS));
+
+        std::string_view args = m_engine->cmdArgs(FuncCallType::Direct);
+        std::size_t size = args.size();
+        for (std::uint8_t i = 0; i < m_argc; i++)
+        {
+            size += m_engine->cmdArgv(i, FuncCallType::Direct).size();
+        }
+
+        // Views are taken while filling, the buffer must not reallocate
+        m_buffer.clear();
+        m_buffer.reserve(size);
+        for (std::uint8_t i = 0; i < m_argc; i++)
+        {
+            std::string_view argv = m_engine->cmdArgv(i, FuncCallType::Direct);
+            m_argv[i] = {m_buffer.data() + m_buffer.size(), argv.size()};
+            m_buffer.append(argv);
+        }
+
+        m_args = {m_buffer.data() + m_buffer.size(), args.size()};
+        m_buffer.append(args);
+        m_nameHash = hashClientCmdName(m_argv[0]);
+    }
+} // namespace Anubis::Game
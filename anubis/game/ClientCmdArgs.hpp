@@ -0,0 +1,63 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <game/IClientCmdArgs.hpp>
+#include <observer_ptr.hpp>
+
+#include <array>
+#include <string>
+
+namespace Anubis::Engine
+{
+    class ILibrary;
+}
+
+namespace Anubis::Game
+{
+    /* Arguments are copied, nested commands tokenize again into the same engine buffers */
+    class ClientCmdArgs final : public IClientCmdArgs
+    {
+    public:
+        /* Same as MAX_ARGS in the engine */
+        static constexpr std::size_t MAX_ARGS = 80;
+
+    public:
+        explicit ClientCmdArgs(nstd::observer_ptr<Engine::ILibrary> engine);
+        ~ClientCmdArgs() final = default;
+
+        [[nodiscard]] std::uint8_t getArgc() const final;
+        [[nodiscard]] std::string_view getArgv(std::uint8_t arg) const final;
+        [[nodiscard]] std::string_view getArgs() const final;
+        [[nodiscard]] std::uint32_t getNameHash() const final;
+        [[nodiscard]] bool isCmd(std::string_view name) const final;
+
+        /* Reads the arguments from the engine again, e.g. after they have been overridden */
+        void tokenize();
+
+    private:
+        nstd::observer_ptr<Engine::ILibrary> m_engine;
+        std::string m_buffer; // arguments and the whole line, views below point here
+        std::array<std::string_view, MAX_ARGS> m_argv;
+        std::string_view m_args;
+        std::uint8_t m_argc = 0;
+        std::uint32_t m_nameHash = 0;
+    };
+} // namespace Anubis::Game
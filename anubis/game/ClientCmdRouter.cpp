@@ -0,0 +1,230 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ClientCmdRouter.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace Anubis::Game
+{
+    namespace
+    {
+        char foldCase(char c)
+        {
+            return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+
+        bool equalsIgnoreCase(std::string_view a, std::string_view b)
+        {
+            return std::equal(a.cbegin(), a.cend(), b.cbegin(), b.cend(),
+                              [](char c1, char c2)
+                              {
+                                  return foldCase(c1) == foldCase(c2);
+                              });
+        }
+    } // namespace
+
+    ClientCmdId ClientCmdRouter::add(std::string_view name, ClientCmdMatch match, ClientCmdCallback callback)
+    {
+        if (name.empty() || !callback)
+        {
+            return INVALID_CLIENT_CMD;
+        }
+
+        // Skip the invalid handle on wrap around
+        if (++m_lastId == INVALID_CLIENT_CMD)
+        {
+            ++m_lastId;
+        }
+
+        auto id = m_lastId;
+        m_handlers.try_emplace(id, Handler {std::string(name), match, std::move(callback)});
+
+        if (match == ClientCmdMatch::Exact)
+        {
+            m_exactHandlers[hashClientCmdName(name)].push_back(id);
+        }
+        else
+        {
+            m_prefixNodes[_findPrefixNode(name, true)].handlers.push_back(id);
+            m_prefixHandlersNum++;
+        }
+
+        return ClientCmdId(id);
+    }
+
+    bool ClientCmdRouter::remove(ClientCmdId id)
+    {
+        auto it = m_handlers.find(id);
+        if (it == m_handlers.end() || it->second.removed)
+        {
+            return false;
+        }
+
+        // Handler may be running right now, erase it after the dispatch is done
+        if (m_dispatchDepth)
+        {
+            it->second.removed = true;
+            m_pendingRemoval.push_back(id);
+            return true;
+        }
+
+        _erase(id);
+        return true;
+    }
+
+    std::optional<ClientCmdResult> ClientCmdRouter::dispatch(nstd::observer_ptr<Engine::IEdict> player,
+                                                             const IClientCmdArgs &cmdArgs)
+    {
+        std::string_view cmdName = cmdArgs.getArgv(0);
+        std::vector<ClientCmdId::BaseType> matched;
+
+        if (auto it = m_exactHandlers.find(cmdArgs.getNameHash()); it != m_exactHandlers.end())
+        {
+            for (auto id : it->second)
+            {
+                if (equalsIgnoreCase(m_handlers.at(id).name, cmdName))
+                {
+                    matched.push_back(id);
+                }
+            }
+        }
+
+        if (m_prefixHandlersNum)
+        {
+            std::uint32_t node = 0;
+            for (char c : cmdName)
+            {
+                const auto &children = m_prefixNodes[node].children;
+                auto child = std::find_if(children.cbegin(), children.cend(),
+                                          [c = foldCase(c)](const auto &edge)
+                                          {
+                                              return edge.first == c;
+                                          });
+
+                if (child == children.cend())
+                {
+                    break;
+                }
+
+                node = child->second;
+                const auto &handlers = m_prefixNodes[node].handlers;
+                matched.insert(matched.end(), handlers.cbegin(), handlers.cend());
+            }
+        }
+
+        if (matched.empty())
+        {
+            return std::nullopt;
+        }
+
+        auto result = ClientCmdResult::Continue;
+
+        m_dispatchDepth++;
+        for (auto id : matched)
+        {
+            auto it = m_handlers.find(id);
+            if (it == m_handlers.end() || it->second.removed)
+            {
+                continue;
+            }
+
+            auto handlerResult = it->second.callback(player, cmdArgs);
+            if (handlerResult == ClientCmdResult::Supercede)
+            {
+                result = ClientCmdResult::Supercede;
+                break;
+            }
+
+            if (handlerResult == ClientCmdResult::Handled)
+            {
+                result = ClientCmdResult::Handled;
+            }
+        }
+        m_dispatchDepth--;
+
+        if (!m_dispatchDepth && !m_pendingRemoval.empty())
+        {
+            for (auto id : m_pendingRemoval)
+            {
+                _erase(id);
+            }
+            m_pendingRemoval.clear();
+        }
+
+        return result;
+    }
+
+    void ClientCmdRouter::_erase(ClientCmdId::BaseType id)
+    {
+        auto it = m_handlers.find(id);
+        if (it == m_handlers.end())
+        {
+            return;
+        }
+
+        std::vector<ClientCmdId::BaseType> *handlers;
+        if (it->second.match == ClientCmdMatch::Exact)
+        {
+            handlers = &m_exactHandlers[hashClientCmdName(it->second.name)];
+        }
+        else
+        {
+            handlers = &m_prefixNodes[_findPrefixNode(it->second.name, false)].handlers;
+            m_prefixHandlersNum--;
+        }
+
+        handlers->erase(std::remove(handlers->begin(), handlers->end(), id), handlers->end());
+        m_handlers.erase(it);
+    }
+
+    std::uint32_t ClientCmdRouter::_findPrefixNode(std::string_view name, bool create)
+    {
+        std::uint32_t node = 0;
+        for (char c : name)
+        {
+            c = foldCase(c);
+            auto &children = m_prefixNodes[node].children;
+            auto child = std::find_if(children.cbegin(), children.cend(),
+                                      [c](const auto &edge)
+                                      {
+                                          return edge.first == c;
+                                      });
+
+            if (child != children.cend())
+            {
+                node = child->second;
+                continue;
+            }
+
+            if (!create)
+            {
+                return 0;
+            }
+
+            auto newNode = static_cast<std::uint32_t>(m_prefixNodes.size());
+            children.emplace_back(c, newNode);
+            m_prefixNodes.emplace_back();
+            node = newNode;
+        }
+
+        return node;
+    }
+} // namespace Anubis::Game
@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <game/IClientCmdArgs.hpp>
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Anubis::Game
+{
+    class ClientCmdRouter
+    {
+    public:
+        ClientCmdId add(std::string_view name, ClientCmdMatch match, ClientCmdCallback callback);
+        bool remove(ClientCmdId id);
+
+        /* Returns std::nullopt if no handler matched the command */
+        std::optional<ClientCmdResult> dispatch(nstd::observer_ptr<Engine::IEdict> player,
+                                                const IClientCmdArgs &cmdArgs);
+
+    private:
+        struct Handler
+        {
+            std::string name;
+            ClientCmdMatch match;
+            ClientCmdCallback callback;
+            bool removed = false;
+        };
+
+        /* Trie over case-folded prefixes, node 0 is the root */
+        struct PrefixNode
+        {
+            std::vector<std::pair<char, std::uint32_t>> children;
+            std::vector<ClientCmdId::BaseType> handlers;
+        };
+
+    private:
+        void _erase(ClientCmdId::BaseType id);
+        std::uint32_t _findPrefixNode(std::string_view name, bool create);
+
+    private:
+        std::unordered_map<ClientCmdId::BaseType, Handler> m_handlers;
+        std::unordered_map<std::uint32_t, std::vector<ClientCmdId::BaseType>> m_exactHandlers;
+        std::vector<PrefixNode> m_prefixNodes = std::vector<PrefixNode>(1);
+        std::size_t m_prefixHandlersNum = 0;
+        std::vector<ClientCmdId::BaseType> m_pendingRemoval;
+        std::uint32_t m_dispatchDepth = 0;
+        ClientCmdId::BaseType m_lastId = INVALID_CLIENT_CMD;
+    };
+} // namespace Anubis::Game
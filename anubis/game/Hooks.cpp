@@ -34,7 +34,14 @@ namespace Anubis::Game
           m_gameShutdownRegistry(std::make_unique<GameShutdownHookRegistry>()),
           m_cvarValueRegistry(std::make_unique<CvarValueHookRegistry>()),
           m_cvarValue2Registry(std::make_unique<CvarValue2HookRegistry>()),
-          m_clientDisconnectHookRegistry(std::make_unique<ClientDisconnectHookRegistry>())
+          m_clientDisconnectHookRegistry(std::make_unique<ClientDisconnectHookRegistry>()),
+          m_addToFullPackRegistry(std::make_unique<AddToFullPackHookRegistry>()),
+          m_cmdStartRegistry(std::make_unique<CmdStartHookRegistry>()),
+          m_cmdEndRegistry(std::make_unique<CmdEndHookRegistry>()),
+          m_playerPreThinkRegistry(std::make_unique<PlayerPreThinkHookRegistry>()),
+          m_playerPostThinkRegistry(std::make_unique<PlayerPostThinkHookRegistry>()),
+          m_pmMoveRegistry(std::make_unique<PMMoveHookRegistry>()),
+          m_keyValueRegistry(std::make_unique<KeyValueHookRegistry>())
     {
     }
 
@@ -103,6 +110,41 @@ namespace Anubis::Game
         return m_clientDisconnectHookRegistry;
     }
 
+    nstd::observer_ptr<IAddToFullPackHookRegistry> Hooks::addToFullPack()
+    {
+        return m_addToFullPackRegistry;
+    }
+
+    nstd::observer_ptr<ICmdStartHookRegistry> Hooks::cmdStart()
+    {
+        return m_cmdStartRegistry;
+    }
+
+    nstd::observer_ptr<ICmdEndHookRegistry> Hooks::cmdEnd()
+    {
+        return m_cmdEndRegistry;
+    }
+
+    nstd::observer_ptr<IPlayerPreThinkHookRegistry> Hooks::playerPreThink()
+    {
+        return m_playerPreThinkRegistry;
+    }
+
+    nstd::observer_ptr<IPlayerPostThinkHookRegistry> Hooks::playerPostThink()
+    {
+        return m_playerPostThinkRegistry;
+    }
+
+    nstd::observer_ptr<IPMMoveHookRegistry> Hooks::pmMove()
+    {
+        return m_pmMoveRegistry;
+    }
+
+    nstd::observer_ptr<IKeyValueHookRegistry> Hooks::keyValue()
+    {
+        return m_keyValueRegistry;
+    }
+
     void Hooks::initCSHooks(nstd::observer_ptr<CStrike::IHooks> hooks)
     {
         m_CSHooks = hooks;
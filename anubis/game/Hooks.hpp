@@ -73,6 +73,41 @@ namespace Anubis::Game
     using ClientDisconnectHook = Hook<void, nstd::observer_ptr<Engine::IEdict>>;
     using ClientDisconnectHookRegistry = HookRegistry<void, nstd::observer_ptr<Engine::IEdict>>;
 
+    using AddToFullPackHook = Hook<bool,
+                                   Engine::EntityState,
+                                   nstd::observer_ptr<Engine::IEdict>,
+                                   nstd::observer_ptr<Engine::IEdict>,
+                                   std::uint32_t,
+                                   bool,
+                                   Engine::VisibilitySet>;
+    using AddToFullPackHookRegistry = HookRegistry<bool,
+                                                   Engine::EntityState,
+                                                   nstd::observer_ptr<Engine::IEdict>,
+                                                   nstd::observer_ptr<Engine::IEdict>,
+                                                   std::uint32_t,
+                                                   bool,
+                                                   Engine::VisibilitySet>;
+
+    using CmdStartHook = Hook<void, nstd::observer_ptr<Engine::IEdict>, Engine::UserCmd, std::uint32_t>;
+    using CmdStartHookRegistry = HookRegistry<void, nstd::observer_ptr<Engine::IEdict>, Engine::UserCmd, std::uint32_t>;
+
+    using CmdEndHook = Hook<void, nstd::observer_ptr<Engine::IEdict>>;
+    using CmdEndHookRegistry = HookRegistry<void, nstd::observer_ptr<Engine::IEdict>>;
+
+    using PlayerPreThinkHook = Hook<void, nstd::observer_ptr<Engine::IEdict>>;
+    using PlayerPreThinkHookRegistry = HookRegistry<void, nstd::observer_ptr<Engine::IEdict>>;
+
+    using PlayerPostThinkHook = Hook<void, nstd::observer_ptr<Engine::IEdict>>;
+    using PlayerPostThinkHookRegistry = HookRegistry<void, nstd::observer_ptr<Engine::IEdict>>;
+
+    using PMMoveHook = Hook<void, nstd::observer_ptr<IPlayerMove>, bool>;
+    using PMMoveHookRegistry = HookRegistry<void, nstd::observer_ptr<IPlayerMove>, bool>;
+
+    using KeyValueHook =
+        Hook<bool, nstd::observer_ptr<Engine::IEdict>, std::string_view, std::string_view, std::string_view>;
+    using KeyValueHookRegistry =
+        HookRegistry<bool, nstd::observer_ptr<Engine::IEdict>, std::string_view, std::string_view, std::string_view>;
+
     class Hooks final : public IHooks
     {
     public:
@@ -94,9 +129,22 @@ namespace Anubis::Game
         nstd::observer_ptr<ICvarValueHookRegistry> cvarValue() final;
         nstd::observer_ptr<ICvarValue2HookRegistry> cvarValue2() final;
         nstd::observer_ptr<IClientDisconnectHookRegistry> clientDisconnect() final;
+        nstd::observer_ptr<IAddToFullPackHookRegistry> addToFullPack() final;
+        nstd::observer_ptr<ICmdStartHookRegistry> cmdStart() final;
+        nstd::observer_ptr<ICmdEndHookRegistry> cmdEnd() final;
+        nstd::observer_ptr<IPlayerPreThinkHookRegistry> playerPreThink() final;
+        nstd::observer_ptr<IPlayerPostThinkHookRegistry> playerPostThink() final;
+        nstd::observer_ptr<IPMMoveHookRegistry> pmMove() final;
+        nstd::observer_ptr<IKeyValueHookRegistry> keyValue() final;
 
         void initCSHooks(nstd::observer_ptr<CStrike::IHooks> hooks);
 
+        /* PM_Move runs for every user command, so it skips building the hook chain when nobody hooks it */
+        [[nodiscard]] bool hasPMMoveHooks() const
+        {
+            return m_pmMoveRegistry->hasHooks();
+        }
+
     private:
         std::unique_ptr<GameInitHookRegistry> m_gameInitRegistry;
         std::unique_ptr<SpawnHookRegistry> m_spawnRegistry;
@@ -111,6 +159,13 @@ namespace Anubis::Game
         std::unique_ptr<CvarValueHookRegistry> m_cvarValueRegistry;
         std::unique_ptr<CvarValue2HookRegistry> m_cvarValue2Registry;
         std::unique_ptr<ClientDisconnectHookRegistry> m_clientDisconnectHookRegistry;
+        std::unique_ptr<AddToFullPackHookRegistry> m_addToFullPackRegistry;
+        std::unique_ptr<CmdStartHookRegistry> m_cmdStartRegistry;
+        std::unique_ptr<CmdEndHookRegistry> m_cmdEndRegistry;
+        std::unique_ptr<PlayerPreThinkHookRegistry> m_playerPreThinkRegistry;
+        std::unique_ptr<PlayerPostThinkHookRegistry> m_playerPostThinkRegistry;
+        std::unique_ptr<PMMoveHookRegistry> m_pmMoveRegistry;
+        std::unique_ptr<KeyValueHookRegistry> m_keyValueRegistry;
 
     private:
         nstd::observer_ptr<CStrike::IHooks> m_CSHooks;
@@ -22,18 +22,29 @@
 #include <EngineExports.hpp>
 
 #include "Library.hpp"
+#include "ClientCmdArgs.hpp"
 #include "engine/Callbacks.hpp"
+#include "engine/Library.hpp"
 
 #include <Anubis.hpp>
 #include <DllExports.hpp>
 #include <engine/ILibrary.hpp>
+#include <engine/IClientInfo.hpp>
+#include <engine/IEdict.hpp>
+#include <engine/IHooks.hpp>
+
+#include <utility>
 
 namespace Anubis::Game
 {
-    Library::Library(nstd::observer_ptr<Engine::ILibrary> engine,
+    Library::Library(nstd::observer_ptr<Engine::Library> engine,
                      std::string_view gameDir,
                      const std::unique_ptr<Logger> &logger)
         : m_hooks(std::make_unique<Hooks>()),
+          m_clientCmdRouter(std::make_unique<ClientCmdRouter>()),
+          m_transmitFilter(std::make_unique<TransmitFilter>(engine->getMaxClientsLimit())),
+          m_userCmdHistory(std::make_unique<UserCmdHistory>(engine->getMaxClientsLimit())),
+          m_playerMove(std::make_unique<PlayerMove>()),
           m_engine(engine),
           m_logger(logger),
           m_dllFunctions(std::make_unique<DLL_FUNCTIONS>()),
@@ -70,6 +81,19 @@ namespace Anubis::Game
         Callbacks::Engine::getEngine(m_engine);
         Engine::Callbacks::GameDLL::getGame(this);
 
+        // Transmit state of the removed entity must not apply to the next one in the same slot
+        m_engine->getHooks()->edFree()->registerHook(
+            [this](const std::unique_ptr<Engine::IEdFreeHook> &hook, nstd::observer_ptr<Engine::IEdict> edict)
+            {
+                hook->callNext(edict);
+
+                if (edict->isFree())
+                {
+                    m_transmitFilter->clearEntity(edict->getIndex());
+                }
+            },
+            HookPriority::Uninterruptable);
+
         auto modId = static_cast<std::underlying_type_t<Mod>>(m_modType);
 
         m_gameDir = std::filesystem::current_path() / gameDir;
@@ -192,6 +216,13 @@ namespace Anubis::Game
         ASSIGN_ENT_FUNC(pfnServerDeactivate);
         ASSIGN_ENT_FUNC(pfnStartFrame);
         ASSIGN_ENT_FUNC(pfnClientDisconnect);
+        ASSIGN_ENT_FUNC(pfnAddToFullPack);
+        ASSIGN_ENT_FUNC(pfnCmdStart);
+        ASSIGN_ENT_FUNC(pfnCmdEnd);
+        ASSIGN_ENT_FUNC(pfnPlayerPreThink);
+        ASSIGN_ENT_FUNC(pfnPlayerPostThink);
+        ASSIGN_ENT_FUNC(pfnPM_Move);
+        ASSIGN_ENT_FUNC(pfnKeyValue);
 #undef ASSIGN_ENT_FUNC
 #define ASSIGN_NEW_DLL_FUNC(func) ((*m_newDllFunctions).func = Callbacks::Engine::func)
         ASSIGN_NEW_DLL_FUNC(pfnGameShutdown);
@@ -338,12 +369,299 @@ namespace Anubis::Game
 
         static auto hookChain = m_hooks->clientCmd();
 
-        hookChain->callChain(
-            [this](nstd::observer_ptr<Engine::IEdict> pEntity)
+        ClientCmdArgs cmdArgs(m_engine);
+
+        bool argsOverridden = false;
+        if (cmdArgs.isCmd("say") || cmdArgs.isCmd("say_team"))
+        {
+            static std::string replacedMsg;
+            switch (gAnubisApi->getChatFilter()->filter(cmdArgs.getArgs(), replacedMsg))
+            {
+                case ChatFilter::Action::Block:
+                    return;
+                case ChatFilter::Action::Replace:
+                    m_engine->overrideCmdArgs(cmdArgs.getArgv(0), replacedMsg);
+                    cmdArgs.tokenize();
+                    argsOverridden = true;
+                    break;
+                case ChatFilter::Action::Flag:
+                    _logFlaggedMsg(pEntity, cmdArgs.getArgs());
+                    break;
+                case ChatFilter::Action::None:
+                    break;
+            }
+        }
+
+        /* Commands can be nested (e.g. fake client commands issued from a hook), restore the outer view after */
+        auto prevCmdArgs = std::exchange(m_clientCmdArgs, nstd::make_observer<IClientCmdArgs>(&cmdArgs));
+
+        // Commands with registered handlers do not go through the generic chain
+        if (auto result = m_clientCmdRouter->dispatch(pEntity, cmdArgs); result)
+        {
+            if (*result == ClientCmdResult::Continue)
             {
                 m_gameLibDllFunctions->pfnClientCommand(static_cast<edict_t *>(*pEntity));
+            }
+        }
+        else
+        {
+            hookChain->callChain(
+                [this](nstd::observer_ptr<Engine::IEdict> pEntity)
+                {
+                    m_gameLibDllFunctions->pfnClientCommand(static_cast<edict_t *>(*pEntity));
+                },
+                pEntity);
+        }
+
+        m_clientCmdArgs = prevCmdArgs;
+
+        if (argsOverridden)
+        {
+            m_engine->clearCmdArgsOverride();
+        }
+    }
+
+    void Library::_logFlaggedMsg(nstd::observer_ptr<Engine::IEdict> player, std::string_view msg) const
+    {
+        std::string_view name;
+        if (auto clientInfo = m_engine->getClientInfo(player); clientInfo)
+        {
+            name = clientInfo->getInfoValue("name");
+        }
+
+        m_logger->logMsg(LogLevel::Info, LogDest::ConsoleFile, "Chat filter flagged message of {} (#{}): {}", name,
+                         player->getIndex(), msg);
+    }
+
+    nstd::observer_ptr<IClientCmdArgs> Library::getClientCmdArgs() const
+    {
+        return m_clientCmdArgs;
+    }
+
+    ClientCmdId Library::registerClientCmd(std::string_view name, ClientCmdCallback callback, ClientCmdMatch match)
+    {
+        return m_clientCmdRouter->add(name, match, std::move(callback));
+    }
+
+    bool Library::unregisterClientCmd(ClientCmdId id)
+    {
+        return m_clientCmdRouter->remove(id);
+    }
+
+    nstd::observer_ptr<ITransmitFilter> Library::getTransmitFilter() const
+    {
+        return m_transmitFilter;
+    }
+
+    const std::unique_ptr<TransmitFilter> &Library::getTransmitFilterImpl() const
+    {
+        return m_transmitFilter;
+    }
+
+    bool Library::pfnAddToFullPack(Engine::EntityState state,
+                                   nstd::observer_ptr<Engine::IEdict> entity,
+                                   nstd::observer_ptr<Engine::IEdict> host,
+                                   std::uint32_t hostFlags,
+                                   bool player,
+                                   Engine::VisibilitySet set,
+                                   FuncCallType callType)
+    {
+        auto gameDLLFn = [this](Engine::EntityState state, nstd::observer_ptr<Engine::IEdict> entity,
+                                nstd::observer_ptr<Engine::IEdict> host, std::uint32_t hostFlags, bool player,
+                                Engine::VisibilitySet set)
+        {
+            return m_gameLibDllFunctions->pfnAddToFullPack(
+                       state, static_cast<int>(entity->getIndex()), static_cast<edict_t *>(*entity),
+                       static_cast<edict_t *>(*host), static_cast<int>(hostFlags), player ? 1 : 0, set) != 0;
+        };
+
+        if (callType == FuncCallType::Direct)
+        {
+            return gameDLLFn(state, entity, host, hostFlags, player, set);
+        }
+
+        static auto hookChain = m_hooks->addToFullPack();
+
+        return hookChain->callChain(gameDLLFn, state, entity, host, hostFlags, player, set);
+    }
+
+    int Library::addToFullPack(entity_state_s *state,
+                               int e,
+                               edict_t *ent,
+                               edict_t *host,
+                               int hostFlags,
+                               int player,
+                               unsigned char *set)
+    {
+        auto entityIndex = static_cast<std::uint32_t>(e);
+        std::uint8_t flags = m_transmitFilter->getFlags(static_cast<std::uint32_t>(host - m_edictList), entityIndex);
+
+        if (flags & TransmitFilter::NEVER)
+        {
+            return 0;
+        }
+
+        // Engine does not check visibility without the set
+        if (flags & TransmitFilter::ALWAYS)
+        {
+            set = nullptr;
+        }
+
+        bool added;
+        if (flags & TransmitFilter::HOOKED)
+        {
+            added = pfnAddToFullPack(Engine::EntityState(state), m_engine->getEdict(ent), m_engine->getEdict(host),
+                                     static_cast<std::uint32_t>(hostFlags), player != 0, Engine::VisibilitySet(set),
+                                     FuncCallType::Hooks);
+        }
+        else
+        {
+            added = m_gameLibDllFunctions->pfnAddToFullPack(state, e, ent, host, hostFlags, player, set) != 0;
+        }
+
+        if (added && (flags & TransmitFilter::OVERRIDDEN))
+        {
+            m_transmitFilter->applyOverride(entityIndex, state);
+        }
+
+        return added ? 1 : 0;
+    }
+
+    void Library::pfnCmdStart(nstd::observer_ptr<Engine::IEdict> player,
+                              Engine::UserCmd cmd,
+                              std::uint32_t randomSeed,
+                              FuncCallType callType)
+    {
+        if (callType == FuncCallType::Direct)
+        {
+            return m_gameLibDllFunctions->pfnCmdStart(static_cast<edict_t *>(*player), cmd, randomSeed);
+        }
+
+        static auto hookChain = m_hooks->cmdStart();
+
+        hookChain->callChain(
+            [this](nstd::observer_ptr<Engine::IEdict> player, Engine::UserCmd cmd, std::uint32_t randomSeed)
+            {
+                m_gameLibDllFunctions->pfnCmdStart(static_cast<edict_t *>(*player), cmd, randomSeed);
             },
-            pEntity);
+            player, cmd, randomSeed);
+    }
+
+    void Library::pfnCmdEnd(nstd::observer_ptr<Engine::IEdict> player, FuncCallType callType)
+    {
+        if (callType == FuncCallType::Direct)
+        {
+            return m_gameLibDllFunctions->pfnCmdEnd(static_cast<edict_t *>(*player));
+        }
+
+        static auto hookChain = m_hooks->cmdEnd();
+
+        hookChain->callChain(
+            [this](nstd::observer_ptr<Engine::IEdict> player)
+            {
+                m_gameLibDllFunctions->pfnCmdEnd(static_cast<edict_t *>(*player));
+            },
+            player);
+    }
+
+    void Library::pfnPlayerPreThink(nstd::observer_ptr<Engine::IEdict> player, FuncCallType callType)
+    {
+        if (callType == FuncCallType::Direct)
+        {
+            return m_gameLibDllFunctions->pfnPlayerPreThink(static_cast<edict_t *>(*player));
+        }
+
+        static auto hookChain = m_hooks->playerPreThink();
+
+        hookChain->callChain(
+            [this](nstd::observer_ptr<Engine::IEdict> player)
+            {
+                m_gameLibDllFunctions->pfnPlayerPreThink(static_cast<edict_t *>(*player));
+            },
+            player);
+    }
+
+    void Library::pfnPlayerPostThink(nstd::observer_ptr<Engine::IEdict> player, FuncCallType callType)
+    {
+        if (callType == FuncCallType::Direct)
+        {
+            return m_gameLibDllFunctions->pfnPlayerPostThink(static_cast<edict_t *>(*player));
+        }
+
+        static auto hookChain = m_hooks->playerPostThink();
+
+        hookChain->callChain(
+            [this](nstd::observer_ptr<Engine::IEdict> player)
+            {
+                m_gameLibDllFunctions->pfnPlayerPostThink(static_cast<edict_t *>(*player));
+            },
+            player);
+    }
+
+    std::size_t
+        Library::getUserCmds(nstd::observer_ptr<Engine::IEdict> player, UserCmdRecord *records, std::size_t num) const
+    {
+        return m_userCmdHistory->copy(player->getIndex(), records, num);
+    }
+
+    const std::unique_ptr<UserCmdHistory> &Library::getUserCmdHistory() const
+    {
+        return m_userCmdHistory;
+    }
+
+    void Library::pfnPMMove(nstd::observer_ptr<IPlayerMove> playerMove, bool server, FuncCallType callType)
+    {
+        if (callType == FuncCallType::Direct)
+        {
+            return m_gameLibDllFunctions->pfnPM_Move(static_cast<playermove_s *>(*playerMove), server ? 1 : 0);
+        }
+
+        static auto hookChain = m_hooks->pmMove();
+
+        hookChain->callChain(
+            [this](nstd::observer_ptr<IPlayerMove> playerMove, bool server)
+            {
+                m_gameLibDllFunctions->pfnPM_Move(static_cast<playermove_s *>(*playerMove), server ? 1 : 0);
+            },
+            playerMove, server);
+    }
+
+    bool Library::pfnKeyValue(nstd::observer_ptr<Engine::IEdict> entity,
+                              std::string_view className,
+                              std::string_view key,
+                              std::string_view value,
+                              FuncCallType callType)
+    {
+        auto keyValueFn = [this](nstd::observer_ptr<Engine::IEdict> entity, std::string_view className,
+                                 std::string_view key, std::string_view value)
+        {
+            // Data of the class name is null if the engine has not passed any
+            KeyValueData keyValueData {const_cast<char *>(className.data()), const_cast<char *>(key.data()),
+                                       const_cast<char *>(value.data()), 0};
+            m_gameLibDllFunctions->pfnKeyValue(static_cast<edict_t *>(*entity), &keyValueData);
+
+            return keyValueData.fHandled != 0;
+        };
+
+        if (callType == FuncCallType::Direct)
+        {
+            return keyValueFn(entity, className, key, value);
+        }
+
+        static auto hookChain = m_hooks->keyValue();
+
+        return hookChain->callChain(keyValueFn, entity, className, key, value);
+    }
+
+    void Library::pmMove(playermove_s *playerMove, int server)
+    {
+        if (!m_hooks->hasPMMoveHooks())
+        {
+            return m_gameLibDllFunctions->pfnPM_Move(playerMove, server);
+        }
+
+        m_playerMove->setPlayerMove(playerMove);
+        pfnPMMove(m_playerMove, server != 0, FuncCallType::Hooks);
     }
 
     void Library::pfnClientUserInfoChanged(nstd::observer_ptr<Engine::IEdict> pEntity,
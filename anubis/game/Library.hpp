@@ -25,12 +25,21 @@
 #include "Hooks.hpp"
 #include "Logger.hpp"
 #include "IEntityHolder.hpp"
+#include "ClientCmdRouter.hpp"
+#include "TransmitFilter.hpp"
+#include "UserCmdHistory.hpp"
+#include "PlayerMove.hpp"
 
 class CBaseEntity;
 
 #include <limits>
 #include <array>
 
+namespace Anubis::Engine
+{
+    class Library;
+}
+
 namespace Anubis::Game
 {
     struct ModInfo
@@ -46,7 +55,7 @@ namespace Anubis::Game
     {
     public:
         Library() = delete;
-        Library(nstd::observer_ptr<Engine::ILibrary> engine,
+        Library(nstd::observer_ptr<Engine::Library> engine,
                 std::string_view gameDir,
                 const std::unique_ptr<Logger> &logger);
 
@@ -92,6 +101,34 @@ namespace Anubis::Game
         nstd::observer_ptr<IRules> getRules() const final;
         void initVFuncHooks() final;
         std::unique_ptr<IBaseEntity> getBaseEntity(edict_t *entity) const final;
+        [[nodiscard]] nstd::observer_ptr<IClientCmdArgs> getClientCmdArgs() const final;
+        ClientCmdId registerClientCmd(std::string_view name,
+                                      ClientCmdCallback callback,
+                                      ClientCmdMatch match) final;
+        bool unregisterClientCmd(ClientCmdId id) final;
+        [[nodiscard]] nstd::observer_ptr<ITransmitFilter> getTransmitFilter() const final;
+        bool pfnAddToFullPack(Engine::EntityState state,
+                              nstd::observer_ptr<Engine::IEdict> entity,
+                              nstd::observer_ptr<Engine::IEdict> host,
+                              std::uint32_t hostFlags,
+                              bool player,
+                              Engine::VisibilitySet set,
+                              FuncCallType callType) final;
+        void pfnCmdStart(nstd::observer_ptr<Engine::IEdict> player,
+                         Engine::UserCmd cmd,
+                         std::uint32_t randomSeed,
+                         FuncCallType callType) final;
+        void pfnCmdEnd(nstd::observer_ptr<Engine::IEdict> player, FuncCallType callType) final;
+        void pfnPlayerPreThink(nstd::observer_ptr<Engine::IEdict> player, FuncCallType callType) final;
+        void pfnPlayerPostThink(nstd::observer_ptr<Engine::IEdict> player, FuncCallType callType) final;
+        std::size_t
+            getUserCmds(nstd::observer_ptr<Engine::IEdict> player, UserCmdRecord *records, std::size_t num) const final;
+        void pfnPMMove(nstd::observer_ptr<IPlayerMove> playerMove, bool server, FuncCallType callType) final;
+        bool pfnKeyValue(nstd::observer_ptr<Engine::IEdict> entity,
+                         std::string_view className,
+                         std::string_view key,
+                         std::string_view value,
+                         FuncCallType callType) final;
 
         const std::unique_ptr<DLL_FUNCTIONS> &getDllFuncs() final;
         const std::unique_ptr<NEW_DLL_FUNCTIONS> &getNewDllFuncs() final;
@@ -99,11 +136,26 @@ namespace Anubis::Game
         void setMaxClients(std::uint32_t maxClients);
         void setEdictList(edict_t *edictList);
         void freeEntitiesDLL();
+        [[nodiscard]] const std::unique_ptr<TransmitFilter> &getTransmitFilterImpl() const;
+        [[nodiscard]] const std::unique_ptr<UserCmdHistory> &getUserCmdHistory() const;
+
+        /* Answers from the transmit filter, the hook chain is called only for hooked entities */
+        int addToFullPack(entity_state_s *state,
+                          int e,
+                          edict_t *ent,
+                          edict_t *host,
+                          int hostFlags,
+                          int player,
+                          unsigned char *set);
+
+        /* Calls the game directly when PM_Move is not hooked */
+        void pmMove(playermove_s *playerMove, int server);
 
     private:
         void _loadGameDLL();
         void _replaceFuncs();
         void _initGameEntityDLL(std::filesystem::path &&path);
+        void _logFlaggedMsg(nstd::observer_ptr<Engine::IEdict> player, std::string_view msg) const;
 
     private:
         constexpr static inline std::size_t knownGamesNum = 6;
@@ -126,7 +178,11 @@ namespace Anubis::Game
 
     private:
         std::unique_ptr<Hooks> m_hooks;
-        nstd::observer_ptr<Engine::ILibrary> m_engine;
+        std::unique_ptr<ClientCmdRouter> m_clientCmdRouter;
+        std::unique_ptr<TransmitFilter> m_transmitFilter;
+        std::unique_ptr<UserCmdHistory> m_userCmdHistory;
+        std::unique_ptr<PlayerMove> m_playerMove;
+        nstd::observer_ptr<Engine::Library> m_engine;
         const std::unique_ptr<Logger> &m_logger;
         std::unique_ptr<DLL_FUNCTIONS> m_dllFunctions;
         std::unique_ptr<NEW_DLL_FUNCTIONS> m_newDllFunctions;
@@ -142,5 +198,6 @@ namespace Anubis::Game
         std::uint32_t m_maxClients = 6;
         edict_t *m_edictList = nullptr;
         nstd::observer_ptr<IRules> m_rules;
+        nstd::observer_ptr<IClientCmdArgs> m_clientCmdArgs;
     };
 } // namespace Anubis::Game
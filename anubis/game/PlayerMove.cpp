@@ -0,0 +1,156 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <extdll.h>
+#include <pm_defs.h>
+
+#include "PlayerMove.hpp"
+
+namespace Anubis::Game
+{
+    std::uint32_t PlayerMove::getPlayerIndex() const
+    {
+        return static_cast<std::uint32_t>(m_playerMove->player_index + 1);
+    }
+
+    bool PlayerMove::isServer() const
+    {
+        return m_playerMove->server != 0;
+    }
+
+    float PlayerMove::getFrameTime() const
+    {
+        return m_playerMove->frametime;
+    }
+
+    std::array<float, 3> PlayerMove::getOrigin() const
+    {
+        return {m_playerMove->origin[0], m_playerMove->origin[1], m_playerMove->origin[2]};
+    }
+
+    std::array<float, 3> PlayerMove::getAngles() const
+    {
+        return {m_playerMove->angles[0], m_playerMove->angles[1], m_playerMove->angles[2]};
+    }
+
+    std::array<float, 3> PlayerMove::getVelocity() const
+    {
+        return {m_playerMove->velocity[0], m_playerMove->velocity[1], m_playerMove->velocity[2]};
+    }
+
+    std::array<float, 3> PlayerMove::getBaseVelocity() const
+    {
+        return {m_playerMove->basevelocity[0], m_playerMove->basevelocity[1], m_playerMove->basevelocity[2]};
+    }
+
+    float PlayerMove::getMaxSpeed() const
+    {
+        return m_playerMove->maxspeed;
+    }
+
+    float PlayerMove::getClientMaxSpeed() const
+    {
+        return m_playerMove->clientmaxspeed;
+    }
+
+    float PlayerMove::getGravity() const
+    {
+        return m_playerMove->gravity;
+    }
+
+    float PlayerMove::getFriction() const
+    {
+        return m_playerMove->friction;
+    }
+
+    Engine::IEdict::Flag PlayerMove::getFlags() const
+    {
+        return static_cast<Engine::IEdict::Flag>(m_playerMove->flags);
+    }
+
+    Engine::IEdict::MoveType PlayerMove::getMoveType() const
+    {
+        return static_cast<Engine::IEdict::MoveType>(m_playerMove->movetype);
+    }
+
+    std::int32_t PlayerMove::getOnGround() const
+    {
+        return m_playerMove->onground;
+    }
+
+    std::int32_t PlayerMove::getWaterLevel() const
+    {
+        return m_playerMove->waterlevel;
+    }
+
+    std::uint16_t PlayerMove::getOldButtons() const
+    {
+        return static_cast<std::uint16_t>(m_playerMove->oldbuttons);
+    }
+
+    Engine::UserCmd PlayerMove::getCmd() const
+    {
+        return Engine::UserCmd(&m_playerMove->cmd);
+    }
+
+    void PlayerMove::setOrigin(std::array<float, 3> origin)
+    {
+        m_playerMove->origin = {origin[0], origin[1], origin[2]};
+    }
+
+    void PlayerMove::setVelocity(std::array<float, 3> velocity)
+    {
+        m_playerMove->velocity = {velocity[0], velocity[1], velocity[2]};
+    }
+
+    void PlayerMove::setBaseVelocity(std::array<float, 3> baseVelocity)
+    {
+        m_playerMove->basevelocity = {baseVelocity[0], baseVelocity[1], baseVelocity[2]};
+    }
+
+    void PlayerMove::setMaxSpeed(float maxSpeed)
+    {
+        m_playerMove->maxspeed = maxSpeed;
+    }
+
+    void PlayerMove::setClientMaxSpeed(float clientMaxSpeed)
+    {
+        m_playerMove->clientmaxspeed = clientMaxSpeed;
+    }
+
+    void PlayerMove::setGravity(float gravity)
+    {
+        m_playerMove->gravity = gravity;
+    }
+
+    void PlayerMove::setFriction(float friction)
+    {
+        m_playerMove->friction = friction;
+    }
+
+    void PlayerMove::setOldButtons(std::uint16_t oldButtons)
+    {
+        m_playerMove->oldbuttons = oldButtons;
+    }
+
+    PlayerMove::operator playermove_s *() const
+    {
+        return m_playerMove;
+    }
+} // namespace Anubis::Game
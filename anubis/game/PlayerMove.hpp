@@ -0,0 +1,70 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <game/IPlayerMove.hpp>
+
+namespace Anubis::Game
+{
+    /* Reused for every PM_Move call, only the pointer to the game's structure changes */
+    class PlayerMove final : public IPlayerMove
+    {
+    public:
+        PlayerMove() = default;
+        ~PlayerMove() final = default;
+
+        [[nodiscard]] std::uint32_t getPlayerIndex() const final;
+        [[nodiscard]] bool isServer() const final;
+        [[nodiscard]] float getFrameTime() const final;
+        [[nodiscard]] std::array<float, 3> getOrigin() const final;
+        [[nodiscard]] std::array<float, 3> getAngles() const final;
+        [[nodiscard]] std::array<float, 3> getVelocity() const final;
+        [[nodiscard]] std::array<float, 3> getBaseVelocity() const final;
+        [[nodiscard]] float getMaxSpeed() const final;
+        [[nodiscard]] float getClientMaxSpeed() const final;
+        [[nodiscard]] float getGravity() const final;
+        [[nodiscard]] float getFriction() const final;
+        [[nodiscard]] Engine::IEdict::Flag getFlags() const final;
+        [[nodiscard]] Engine::IEdict::MoveType getMoveType() const final;
+        [[nodiscard]] std::int32_t getOnGround() const final;
+        [[nodiscard]] std::int32_t getWaterLevel() const final;
+        [[nodiscard]] std::uint16_t getOldButtons() const final;
+        [[nodiscard]] Engine::UserCmd getCmd() const final;
+
+        void setOrigin(std::array<float, 3> origin) final;
+        void setVelocity(std::array<float, 3> velocity) final;
+        void setBaseVelocity(std::array<float, 3> baseVelocity) final;
+        void setMaxSpeed(float maxSpeed) final;
+        void setClientMaxSpeed(float clientMaxSpeed) final;
+        void setGravity(float gravity) final;
+        void setFriction(float friction) final;
+        void setOldButtons(std::uint16_t oldButtons) final;
+
+        explicit operator playermove_s *() const final;
+
+        void setPlayerMove(playermove_s *playerMove)
+        {
+            m_playerMove = playerMove;
+        }
+
+    private:
+        playermove_s *m_playerMove = nullptr;
+    };
+} // namespace Anubis::Game
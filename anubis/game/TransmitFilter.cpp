@@ -0,0 +1,164 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <extdll.h>
+#include <entity_state.h>
+
+#include "TransmitFilter.hpp"
+
+#include <engine/IEdict.hpp>
+
+namespace Anubis::Game
+{
+    TransmitFilter::TransmitFilter(std::uint32_t clientsNum) : m_clients(clientsNum + 1) {}
+
+    void TransmitFilter::setNeverTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                          nstd::observer_ptr<Engine::IEdict> entity,
+                                          bool never)
+    {
+        if (host->getIndex() < m_clients.size())
+        {
+            m_clients[host->getIndex()].never[entity->getIndex()] = never;
+        }
+    }
+
+    void TransmitFilter::setAlwaysTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                           nstd::observer_ptr<Engine::IEdict> entity,
+                                           bool always)
+    {
+        if (host->getIndex() < m_clients.size())
+        {
+            m_clients[host->getIndex()].always[entity->getIndex()] = always;
+        }
+    }
+
+    bool TransmitFilter::isNeverTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                         nstd::observer_ptr<Engine::IEdict> entity) const
+    {
+        return (getFlags(host->getIndex(), entity->getIndex()) & NEVER) != 0;
+    }
+
+    bool TransmitFilter::isAlwaysTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                          nstd::observer_ptr<Engine::IEdict> entity) const
+    {
+        return (getFlags(host->getIndex(), entity->getIndex()) & ALWAYS) != 0;
+    }
+
+    void TransmitFilter::setHooked(nstd::observer_ptr<Engine::IEdict> entity, bool hooked)
+    {
+        m_hooked[entity->getIndex()] = hooked;
+    }
+
+    bool TransmitFilter::isHooked(nstd::observer_ptr<Engine::IEdict> entity) const
+    {
+        return m_hooked[entity->getIndex()];
+    }
+
+    void TransmitFilter::setStateOverride(nstd::observer_ptr<Engine::IEdict> entity,
+                                          std::optional<EntityStateOverride> stateOverride)
+    {
+        std::uint32_t index = entity->getIndex();
+
+        if (stateOverride)
+        {
+            m_overrides.insert_or_assign(index, *stateOverride);
+            m_overridden[index] = true;
+        }
+        else
+        {
+            m_overrides.erase(index);
+            m_overridden[index] = false;
+        }
+    }
+
+    void TransmitFilter::applyOverride(std::uint32_t entity, entity_state_s *state) const
+    {
+        auto it = m_overrides.find(entity);
+        if (it == m_overrides.end())
+        {
+            return;
+        }
+
+        const auto &stateOverride = it->second;
+
+        if (stateOverride.renderMode)
+        {
+            state->rendermode = *stateOverride.renderMode;
+        }
+
+        if (stateOverride.renderAmt)
+        {
+            state->renderamt = *stateOverride.renderAmt;
+        }
+
+        if (stateOverride.renderColor)
+        {
+            state->rendercolor.r = (*stateOverride.renderColor)[0];
+            state->rendercolor.g = (*stateOverride.renderColor)[1];
+            state->rendercolor.b = (*stateOverride.renderColor)[2];
+        }
+
+        if (stateOverride.renderFx)
+        {
+            state->renderfx = *stateOverride.renderFx;
+        }
+
+        if (stateOverride.solid)
+        {
+            state->solid = static_cast<short>(*stateOverride.solid);
+        }
+
+        state->effects = (state->effects | stateOverride.effectsSet) & ~stateOverride.effectsClear;
+    }
+
+    void TransmitFilter::clearEntity(std::uint32_t entity)
+    {
+        for (auto &client : m_clients)
+        {
+            client.never[entity] = false;
+            client.always[entity] = false;
+        }
+
+        m_hooked[entity] = false;
+        m_overridden[entity] = false;
+        m_overrides.erase(entity);
+    }
+
+    void TransmitFilter::clearHost(std::uint32_t host)
+    {
+        if (host < m_clients.size())
+        {
+            m_clients[host].never.reset();
+            m_clients[host].always.reset();
+        }
+    }
+
+    void TransmitFilter::clear()
+    {
+        for (auto &client : m_clients)
+        {
+            client.never.reset();
+            client.always.reset();
+        }
+
+        m_hooked.reset();
+        m_overridden.reset();
+        m_overrides.clear();
+    }
+} // namespace Anubis::Game
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <game/ITransmitFilter.hpp>
+
+#include <bitset>
+#include <unordered_map>
+#include <vector>
+
+namespace Anubis::Game
+{
+    class TransmitFilter final : public ITransmitFilter
+    {
+    public:
+        static constexpr std::uint8_t NEVER = 1 << 0;
+        static constexpr std::uint8_t ALWAYS = 1 << 1;
+        static constexpr std::uint8_t HOOKED = 1 << 2;
+        static constexpr std::uint8_t OVERRIDDEN = 1 << 3;
+
+    public:
+        explicit TransmitFilter(std::uint32_t clientsNum);
+        ~TransmitFilter() final = default;
+
+        void setNeverTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                              nstd::observer_ptr<Engine::IEdict> entity,
+                              bool never) final;
+        void setAlwaysTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                               nstd::observer_ptr<Engine::IEdict> entity,
+                               bool always) final;
+        [[nodiscard]] bool isNeverTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                           nstd::observer_ptr<Engine::IEdict> entity) const final;
+        [[nodiscard]] bool isAlwaysTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                            nstd::observer_ptr<Engine::IEdict> entity) const final;
+        void setHooked(nstd::observer_ptr<Engine::IEdict> entity, bool hooked) final;
+        [[nodiscard]] bool isHooked(nstd::observer_ptr<Engine::IEdict> entity) const final;
+        void setStateOverride(nstd::observer_ptr<Engine::IEdict> entity,
+                              std::optional<EntityStateOverride> stateOverride) final;
+
+        /* Called for every entity, client and frame, so it only tests bits */
+        [[nodiscard]] std::uint8_t getFlags(std::uint32_t host, std::uint32_t entity) const
+        {
+            auto flags = static_cast<std::uint8_t>((m_hooked[entity] ? HOOKED : 0) |
+                                                   (m_overridden[entity] ? OVERRIDDEN : 0));
+
+            if (host < m_clients.size())
+            {
+                const auto &client = m_clients[host];
+                flags = static_cast<std::uint8_t>(flags | (client.never[entity] ? NEVER : 0) |
+                                                  (client.always[entity] ? ALWAYS : 0));
+            }
+
+            return flags;
+        }
+
+        void applyOverride(std::uint32_t entity, entity_state_s *state) const;
+        void clearEntity(std::uint32_t entity);
+        void clearHost(std::uint32_t host);
+        void clear();
+
+    private:
+        struct ClientMasks
+        {
+            std::bitset<Engine::EDICTS_LIMIT> never;
+            std::bitset<Engine::EDICTS_LIMIT> always;
+        };
+
+    private:
+        std::vector<ClientMasks> m_clients; // indexed by edict index, 0 is unused
+        std::bitset<Engine::EDICTS_LIMIT> m_hooked;
+        std::bitset<Engine::EDICTS_LIMIT> m_overridden;
+        std::unordered_map<std::uint32_t, EntityStateOverride> m_overrides;
+    };
+} // namespace Anubis::Game
@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <extdll.h>
+#include <usercmd.h>
+
+#include "UserCmdHistory.hpp"
+
+#include <algorithm>
+
+namespace Anubis::Game
+{
+    UserCmdHistory::UserCmdHistory(std::uint32_t clientsNum) : m_clients(clientsNum + 1) {}
+
+    void UserCmdHistory::record(std::uint32_t client, const usercmd_s *cmd)
+    {
+        if (client >= m_clients.size())
+        {
+            return;
+        }
+
+        Ring &ring = m_clients[client];
+        ring.records[ring.next] = {
+            {cmd->viewangles[0], cmd->viewangles[1], cmd->viewangles[2]},
+            cmd->forwardmove,
+            cmd->sidemove,
+            cmd->upmove,
+            cmd->buttons,
+            cmd->msec,
+            cmd->impulse
+        };
+
+        ring.next = (ring.next + 1) % USER_CMD_RECORDS_NUM;
+        ring.size = std::min(ring.size + 1, USER_CMD_RECORDS_NUM);
+    }
+
+    std::size_t UserCmdHistory::copy(std::uint32_t client, UserCmdRecord *records, std::size_t num) const
+    {
+        if (client >= m_clients.size())
+        {
+            return 0;
+        }
+
+        const Ring &ring = m_clients[client];
+        num = std::min(num, ring.size);
+
+        // Oldest first, at most two contiguous chunks
+        std::size_t first = (ring.next + USER_CMD_RECORDS_NUM - num) % USER_CMD_RECORDS_NUM;
+        std::size_t firstNum = std::min(num, USER_CMD_RECORDS_NUM - first);
+        std::copy_n(ring.records.begin() + first, firstNum, records);
+        std::copy_n(ring.records.begin(), num - firstNum, records + firstNum);
+
+        return num;
+    }
+
+    void UserCmdHistory::clear(std::uint32_t client)
+    {
+        if (client < m_clients.size())
+        {
+            m_clients[client].next = 0;
+            m_clients[client].size = 0;
+        }
+    }
+} // namespace Anubis::Game
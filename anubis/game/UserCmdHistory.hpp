@@ -0,0 +1,51 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <game/UserCmdRecord.hpp>
+
+#include <vector>
+
+struct usercmd_s;
+
+namespace Anubis::Game
+{
+    /* Ring of the last user commands for every client, indexed by edict index */
+    class UserCmdHistory
+    {
+    public:
+        explicit UserCmdHistory(std::uint32_t clientsNum);
+
+        void record(std::uint32_t client, const usercmd_s *cmd);
+        std::size_t copy(std::uint32_t client, UserCmdRecord *records, std::size_t num) const;
+        void clear(std::uint32_t client);
+
+    private:
+        struct Ring
+        {
+            std::array<UserCmdRecord, USER_CMD_RECORDS_NUM> records;
+            std::size_t next = 0;
+            std::size_t size = 0;
+        };
+
+    private:
+        std::vector<Ring> m_clients; // 0 is unused
+    };
+} // namespace Anubis::Game
@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* Fills a ban index with synthetic addresses and auth IDs and measures inserts and lookups.
+ * Usage: ban_index_benchmark [entries], 1M entries of each kind by default. */
+
+#include <BanIndex.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::size_t DEFAULT_ENTRIES = 1000000;
+
+    std::string formatIPv4(std::uint32_t ip)
+    {
+        return std::to_string(ip >> 24) + '.' + std::to_string((ip >> 16) & 0xFF) + '.' +
+               std::to_string((ip >> 8) & 0xFF) + '.' + std::to_string(ip & 0xFF);
+    }
+
+    /* Average nanoseconds per entry since start */
+    double perEntry(Clock::time_point start, std::size_t entriesNum)
+    {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+               static_cast<double>(entriesNum);
+    }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::size_t entriesNum = DEFAULT_ENTRIES;
+    if (argc > 1)
+    {
+        entriesNum = std::max<std::size_t>(std::strtoul(argv[1], nullptr, 10), 1);
+    }
+
+    // Fixed seed keeps the runs comparable, every fourth address is a range
+    std::mt19937 random(0x414E5542);
+    std::vector<std::string> addresses(entriesNum);
+    std::vector<std::string> authIDs(entriesNum);
+    for (std::size_t i = 0; i < entriesNum; i++)
+    {
+        addresses[i] = formatIPv4(random());
+        if (!(i % 4))
+        {
+            addresses[i].append("/").append(std::to_string(16 + random() % 15));
+        }
+
+        authIDs[i] = "STEAM_0:" + std::to_string(i % 2) + ':' + std::to_string(random());
+    }
+
+    // Half of the lookups are entries which have been added, the other half most likely is not banned
+    std::vector<std::string> addressLookups(entriesNum);
+    std::vector<std::string> authIDLookups(entriesNum);
+    for (std::size_t i = 0; i < entriesNum; i++)
+    {
+        bool added = i % 2;
+        addressLookups[i] = added ? addresses[i].substr(0, addresses[i].find('/')) : formatIPv4(random());
+        authIDLookups[i] = added ? authIDs[i] : "STEAM_1:0:" + std::to_string(random());
+    }
+
+    // Index is never saved, the path is not used
+    Anubis::BanIndex index({});
+    std::size_t bannedNum = 0;
+
+    auto start = Clock::now();
+    for (const auto &address : addresses)
+    {
+        index.addAddress(address);
+    }
+    double addressInsert = perEntry(start, entriesNum);
+
+    start = Clock::now();
+    for (const auto &address : addressLookups)
+    {
+        bannedNum += index.isAddressBanned(address);
+    }
+    double addressLookup = perEntry(start, entriesNum);
+
+    start = Clock::now();
+    for (const auto &authID : authIDs)
+    {
+        index.addAuthID(authID);
+    }
+    double authIDInsert = perEntry(start, entriesNum);
+
+    start = Clock::now();
+    for (const auto &authID : authIDLookups)
+    {
+        bannedNum += index.isAuthIDBanned(authID);
+    }
+    double authIDLookup = perEntry(start, entriesNum);
+
+    // Printing the hits keeps the lookups from being optimized out
+    std::printf("Ban index with %zu addresses and %zu auth IDs:\n", entriesNum, entriesNum);
+    std::printf("  Addresses: %.1f ns/insert %.1f ns/lookup\n", addressInsert, addressLookup);
+    std::printf("  Auth IDs: %.1f ns/insert %.1f ns/lookup\n", authIDInsert, authIDLookup);
+    std::printf("  Banned lookups: %zu\n", bannedNum);
+
+    return 0;
+}
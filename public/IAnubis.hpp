@@ -26,6 +26,13 @@
 #include "IHookChains.hpp"
 #include "IMsg.hpp"
 #include "ILogger.hpp"
+#include "ITimers.hpp"
+#include "IPlayerStorage.hpp"
+#include "IBanIndex.hpp"
+#include "ICvarQueries.hpp"
+#include "IPlayerHistory.hpp"
+#include "IEntityPools.hpp"
+#include "IEntityWatcher.hpp"
 
 #include <filesystem>
 #include <any>
@@ -91,7 +98,7 @@ namespace Anubis
         /**
          * @brief Anubis API minor version
          */
-        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(1);
 
         /**
          * @brief Anubis API version
@@ -173,6 +180,83 @@ namespace Anubis
          * @return Path
          */
         virtual const std::filesystem::path &getPath(PathType pathType) = 0;
+
+        /**
+         * @brief Retrieves ITimers instance.
+         *
+         * Allows to schedule timers without polling the time in every frame.
+         *
+         * @note Available since 2.1
+         *
+         * @return ITimers instance
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<ITimers> getTimers(InterfaceVersion version) const = 0;
+
+        /**
+         * @brief Retrieves IPlayerStorage instance.
+         *
+         * Allows to keep per-player data indexed by client slot.
+         *
+         * @note Available since 2.1
+         *
+         * @return IPlayerStorage instance
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<IPlayerStorage> getPlayerStorage(InterfaceVersion version) const = 0;
+
+        /**
+         * @brief Retrieves IBanIndex instance.
+         *
+         * Allows to ban addresses and auth IDs, connecting clients are checked against them by Anubis.
+         *
+         * @note Available since 2.1
+         *
+         * @return IBanIndex instance
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<IBanIndex> getBanIndex(InterfaceVersion version) const = 0;
+
+        /**
+         * @brief Retrieves ICvarQueries instance.
+         *
+         * Allows to query client cvars with per-query callbacks and timeouts.
+         *
+         * @note Available since 2.1
+         *
+         * @return ICvarQueries instance
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<ICvarQueries> getCvarQueries(InterfaceVersion version) const = 0;
+
+        /**
+         * @brief Retrieves IPlayerHistory instance.
+         *
+         * Allows to look up past positions of players.
+         *
+         * @note Available since 2.1
+         *
+         * @return IPlayerHistory instance
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<IPlayerHistory> getPlayerHistory(InterfaceVersion version) const = 0;
+
+        /**
+         * @brief Retrieves IEntityPools instance.
+         *
+         * Allows to reuse short-lived entities instead of creating and removing them.
+         *
+         * @note Available since 2.1
+         *
+         * @return IEntityPools instance
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<IEntityPools> getEntityPools(InterfaceVersion version) const = 0;
+
+        /**
+         * @brief Retrieves IEntityWatcher instance.
+         *
+         * Allows to be notified about changes of entity fields instead of polling them.
+         *
+         * @note Available since 2.1
+         *
+         * @return IEntityWatcher instance
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<IEntityWatcher> getEntityWatcher(InterfaceVersion version) const = 0;
     };
 #if !defined ANUBIS_CORE
     /**
@@ -0,0 +1,137 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+namespace Anubis
+{
+    /**
+     * @brief Ban index interface
+     *
+     * Keeps banned IPv4 addresses and CIDR ranges in a compressed radix trie and banned auth IDs in a hash set.
+     * Connecting clients are checked against the index before any plugin sees them.
+     * The index is loaded from a binary file in the configs directory and can be changed at runtime.
+     */
+    class IBanIndex
+    {
+    public:
+        /**
+         * @brief Ban index API major version
+         */
+        static constexpr MajorInterfaceVersion MAJOR_VERSION = MajorInterfaceVersion(1);
+
+        /**
+         * @brief Ban index API minor version
+         */
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+
+        /**
+         * @brief Ban index API version
+         *
+         * Major version is present in the 16 most significant bits.
+         * Minor version is present in the 16 least significant bits.
+         */
+        static constexpr InterfaceVersion VERSION = InterfaceVersion(MAJOR_VERSION << 16 | MINOR_VERSION);
+
+    public:
+        virtual ~IBanIndex() = default;
+
+        /**
+         * @brief Bans IPv4 address or CIDR range.
+         *
+         * @param cidr      Address (e.g. 192.168.1.1) or range (e.g. 192.168.0.0/16).
+         *
+         * @return True if the entry was added, false if it is malformed or already present.
+         */
+        virtual bool addAddress(std::string_view cidr) = 0;
+
+        /**
+         * @brief Removes ban of IPv4 address or CIDR range.
+         *
+         * @note Only the exact entry is removed, addresses covered by other entries stay banned.
+         *
+         * @param cidr      Address or range as it was added.
+         *
+         * @return True if the entry was removed, false otherwise.
+         */
+        virtual bool removeAddress(std::string_view cidr) = 0;
+
+        /**
+         * @brief Checks if IPv4 address is covered by any banned entry.
+         *
+         * @param address   Address, optionally followed by the port (e.g. 192.168.1.1:27005).
+         *
+         * @return True if address is banned, false otherwise.
+         */
+        [[nodiscard]] virtual bool isAddressBanned(std::string_view address) const = 0;
+
+        /**
+         * @brief Bans auth ID.
+         *
+         * @param authID    Auth ID.
+         *
+         * @return True if the entry was added, false if it is already present.
+         */
+        virtual bool addAuthID(std::string_view authID) = 0;
+
+        /**
+         * @brief Removes ban of auth ID.
+         *
+         * @param authID    Auth ID.
+         *
+         * @return True if the entry was removed, false otherwise.
+         */
+        virtual bool removeAuthID(std::string_view authID) = 0;
+
+        /**
+         * @brief Checks if auth ID is banned.
+         *
+         * @param authID    Auth ID.
+         *
+         * @return True if auth ID is banned, false otherwise.
+         */
+        [[nodiscard]] virtual bool isAuthIDBanned(std::string_view authID) const = 0;
+
+        /**
+         * @brief Returns number of banned addresses and ranges.
+         *
+         * @return Number of entries.
+         */
+        [[nodiscard]] virtual std::size_t getAddressesNum() const = 0;
+
+        /**
+         * @brief Returns number of banned auth IDs.
+         *
+         * @return Number of entries.
+         */
+        [[nodiscard]] virtual std::size_t getAuthIDsNum() const = 0;
+
+        /**
+         * @brief Writes the index to its file.
+         *
+         * @return True if the file was written, false otherwise.
+         */
+        virtual bool save() = 0;
+    };
+} // namespace Anubis
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+#include "observer_ptr.hpp"
+
+#include <functional>
+#include <string_view>
+
+namespace Anubis
+{
+    namespace Engine
+    {
+        class IEdict;
+    }
+
+    /**
+     * @brief Cvar query handle
+     */
+    ANUBIS_STRONG_TYPEDEF(std::uint32_t, CvarQueryId)
+
+    /**
+     * @brief Invalid cvar query handle
+     */
+    static constexpr CvarQueryId INVALID_CVAR_QUERY = CvarQueryId(0);
+
+    /**
+     * @brief Outcome of the cvar query
+     */
+    enum class CvarQueryStatus : std::uint8_t
+    {
+        Answered = 0, /**< Client has sent the value */
+        TimedOut,     /**< Client has not answered in time */
+        Dropped       /**< Client has disconnected before answering */
+    };
+
+    /**
+     * @brief Cvar query callback
+     *
+     * Value is empty unless the status is CvarQueryStatus::Answered.
+     */
+    using CvarQueryCallback = std::function<void(nstd::observer_ptr<Engine::IEdict> player,
+                                                 std::string_view cvarName,
+                                                 std::string_view value,
+                                                 CvarQueryStatus status)>;
+
+    /**
+     * @brief Client cvar queries interface
+     *
+     * Queries client cvars through the engine on behalf of plugins.
+     * Request IDs are allocated by Anubis from a reserved range, so responses are delivered only to the callback
+     * of the query and never reach the cvarValue2 hook chain. Identical queries pending for the same client are sent
+     * only once and the number of queries in flight per client is capped, queries above the cap wait for their turn.
+     */
+    class ICvarQueries
+    {
+    public:
+        /**
+         * @brief Cvar queries API major version
+         */
+        static constexpr MajorInterfaceVersion MAJOR_VERSION = MajorInterfaceVersion(1);
+
+        /**
+         * @brief Cvar queries API minor version
+         */
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+
+        /**
+         * @brief Cvar queries API version
+         *
+         * Major version is present in the 16 most significant bits.
+         * Minor version is present in the 16 least significant bits.
+         */
+        static constexpr InterfaceVersion VERSION = InterfaceVersion(MAJOR_VERSION << 16 | MINOR_VERSION);
+
+        /**
+         * @brief First request ID reserved for Anubis
+         *
+         * Request IDs from FIRST_RESERVED_REQUEST_ID up to LAST_RESERVED_REQUEST_ID should not be used by plugins
+         * which call queryClientCvarValue2() on their own.
+         */
+        static constexpr std::uint32_t FIRST_RESERVED_REQUEST_ID = 0x7A000000;
+
+        /**
+         * @brief Last request ID reserved for Anubis
+         */
+        static constexpr std::uint32_t LAST_RESERVED_REQUEST_ID = 0x7AFFFFFF;
+
+    public:
+        virtual ~ICvarQueries() = default;
+
+        /**
+         * @brief Queries the value of client cvar.
+         *
+         * @param player        Player's edict.
+         * @param cvarName      Name of the cvar.
+         * @param callback      Function to call with the result.
+         * @param timeout       Time in seconds after which the query times out.
+         *
+         * @return Handle of the query or INVALID_CVAR_QUERY if the edict is not a player.
+         */
+        virtual CvarQueryId query(nstd::observer_ptr<Engine::IEdict> player,
+                                  std::string_view cvarName,
+                                  CvarQueryCallback callback,
+                                  float timeout = 5.0f) = 0;
+
+        /**
+         * @brief Cancels the query, its callback will not be called.
+         *
+         * @param id            Handle of the query.
+         *
+         * @return True if query was pending, false otherwise.
+         */
+        virtual bool cancel(CvarQueryId id) = 0;
+
+        /**
+         * @brief Retrieves number of pending queries of the player.
+         *
+         * @param player        Player's edict.
+         *
+         * @return Number of pending queries.
+         */
+        [[nodiscard]] virtual std::size_t getPendingNum(nstd::observer_ptr<Engine::IEdict> player) const = 0;
+    };
+} // namespace Anubis
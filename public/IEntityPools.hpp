@@ -0,0 +1,126 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+#include "observer_ptr.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace Anubis
+{
+    namespace Engine
+    {
+        class IEdict;
+    }
+
+    /**
+     * @brief Statistics of the entity pool
+     */
+    struct EntityPoolStats
+    {
+        std::size_t capacity;  /**< Number of entities kept in the pool */
+        std::size_t available; /**< Entities waiting in the pool */
+        std::size_t inUse;     /**< Entities handed out and not released yet */
+        std::size_t peakInUse; /**< Highest number of entities in use since the map start */
+        std::size_t reused;    /**< Acquisitions served from the pool since the map start */
+        std::size_t created;   /**< Acquisitions which had to create a new entity since the map start */
+    };
+
+    /**
+     * @brief Entity pools interface
+     *
+     * Keeps hidden entities of the given class name created ahead of time, so plugins spawning many short-lived
+     * entities (projectiles, effects, sprites) do not allocate and free edicts all the time.
+     * Released entities are hidden (nodraw, not solid, not moving, not thinking) and handed out again by acquire().
+     *
+     * Pools are filled when the map starts and drained when it ends, pools themselves stay registered.
+     */
+    class IEntityPools
+    {
+    public:
+        /**
+         * @brief Entity pools API major version
+         */
+        static constexpr MajorInterfaceVersion MAJOR_VERSION = MajorInterfaceVersion(1);
+
+        /**
+         * @brief Entity pools API minor version
+         */
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+
+        /**
+         * @brief Entity pools API version
+         *
+         * Major version is present in the 16 most significant bits.
+         * Minor version is present in the 16 least significant bits.
+         */
+        static constexpr InterfaceVersion VERSION = InterfaceVersion(MAJOR_VERSION << 16 | MINOR_VERSION);
+
+    public:
+        virtual ~IEntityPools() = default;
+
+        /**
+         * @brief Creates pool of entities or changes its capacity.
+         *
+         * @note If the map is running, the pool is filled right away.
+         *
+         * @param className     Class name of the entities.
+         * @param capacity      Number of entities to keep in the pool.
+         *
+         * @return True if the pool was created, false if its capacity was changed.
+         */
+        virtual bool createPool(std::string_view className, std::size_t capacity) = 0;
+
+        /**
+         * @brief Hands out the entity of the given class name.
+         *
+         * The entity is taken from the pool or created if the pool is empty. It is visible again, but stays
+         * not solid and not moving until the caller sets it up.
+         *
+         * @param className     Class name of the pool.
+         *
+         * @return Entity or nullptr if there is no such pool or the entity could not be created.
+         */
+        virtual nstd::observer_ptr<Engine::IEdict> acquire(std::string_view className) = 0;
+
+        /**
+         * @brief Takes back the entity handed out by acquire().
+         *
+         * Entity is hidden and kept for reuse or removed if the pool is already full.
+         *
+         * @param entity        Entity to release.
+         *
+         * @return True if the entity was taken back, false if it is not a pooled entity in use.
+         */
+        virtual bool release(nstd::observer_ptr<Engine::IEdict> entity) = 0;
+
+        /**
+         * @brief Retrieves statistics of the pool.
+         *
+         * @param className     Class name of the pool.
+         *
+         * @return Statistics or std::nullopt if there is no such pool.
+         */
+        [[nodiscard]] virtual std::optional<EntityPoolStats> getStats(std::string_view className) const = 0;
+    };
+} // namespace Anubis
@@ -0,0 +1,164 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+#include "observer_ptr.hpp"
+
+#include <functional>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace Anubis
+{
+    namespace Engine
+    {
+        class IEdict;
+    }
+
+    /**
+     * @brief Entity watch handle
+     */
+    ANUBIS_STRONG_TYPEDEF(std::uint32_t, EntityWatchId)
+
+    /**
+     * @brief Invalid entity watch handle
+     */
+    static constexpr EntityWatchId INVALID_ENTITY_WATCH = EntityWatchId(0);
+
+    /**
+     * @brief Fields of entvars which can be watched
+     *
+     * Fields up to RenderAmount hold float values, the rest hold integer values.
+     * Model and WeaponModel are string offsets.
+     */
+    enum class EntityField : std::uint8_t
+    {
+        Health = 0,
+        MaxHealth,
+        ArmorValue,
+        Frags,
+        TakeDamage,
+        RenderAmount,
+        Team,
+        Flags,
+        DeadFlag,
+        Weapons,
+        ModelIndex,
+        Model,
+        WeaponModel,
+        MoveType,
+        Solid,
+        Effects,
+        RenderMode
+    };
+
+    /**
+     * @brief Entities whose fields are watched
+     */
+    enum class EntityWatchScope : std::uint8_t
+    {
+        Players = 0, /**< Player edicts only */
+        NonPlayers,  /**< All edicts except players */
+        All          /**< All edicts */
+    };
+
+    /**
+     * @brief Value of the watched field
+     */
+    using EntityFieldValue = std::variant<std::int32_t, float>;
+
+    /**
+     * @brief Change of the watched field
+     */
+    struct EntityChange
+    {
+        nstd::observer_ptr<Engine::IEdict> entity; /**< Entity whose field has changed */
+        EntityField field;                         /**< Changed field */
+        EntityFieldValue oldValue;                 /**< Value in the previous frame */
+        EntityFieldValue newValue;                 /**< Value in the current frame */
+    };
+
+    /**
+     * @brief Entity watch callback
+     *
+     * Called at most once per frame with all changes matching the watch.
+     */
+    using EntityChangeCallback = std::function<void(const std::vector<EntityChange> &changes)>;
+
+    /**
+     * @brief Entity change tracking interface
+     *
+     * Compares watched fields of entities once per frame, at its start, against their values from the previous frame.
+     * Only fields with at least one watch are compared, others cost nothing. Entities created or removed
+     * in between are not reported, their fields are compared from the next frame on.
+     */
+    class IEntityWatcher
+    {
+    public:
+        /**
+         * @brief Entity watcher API major version
+         */
+        static constexpr MajorInterfaceVersion MAJOR_VERSION = MajorInterfaceVersion(1);
+
+        /**
+         * @brief Entity watcher API minor version
+         */
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+
+        /**
+         * @brief Entity watcher API version
+         *
+         * Major version is present in the 16 most significant bits.
+         * Minor version is present in the 16 least significant bits.
+         */
+        static constexpr InterfaceVersion VERSION = InterfaceVersion(MAJOR_VERSION << 16 | MINOR_VERSION);
+
+    public:
+        virtual ~IEntityWatcher() = default;
+
+        /**
+         * @brief Watches the field of entities.
+         *
+         * Changes are reported from the next frame on.
+         *
+         * @param field         Field to watch.
+         * @param scope         Entities to watch.
+         * @param className     Class name of the entities to watch or empty to watch all of them.
+         * @param callback      Function to call with changes.
+         *
+         * @return Handle of the watch.
+         */
+        virtual EntityWatchId watch(EntityField field,
+                                    EntityWatchScope scope,
+                                    std::string_view className,
+                                    EntityChangeCallback callback) = 0;
+
+        /**
+         * @brief Stops watching, the callback will not be called anymore.
+         *
+         * @param id            Handle of the watch.
+         *
+         * @return True if the watch was removed, false if there is no such watch.
+         */
+        virtual bool unwatch(EntityWatchId id) = 0;
+    };
+} // namespace Anubis
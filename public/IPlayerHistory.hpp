@@ -0,0 +1,118 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+#include "observer_ptr.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+namespace Anubis
+{
+    namespace Engine
+    {
+        class IEdict;
+    }
+
+    /**
+     * @brief Position of the player at the given time
+     */
+    struct PlayerSnapshot
+    {
+        std::uint32_t index; /**< Edict index of the player */
+        float time;
+        std::array<float, 3> origin;
+        std::array<float, 3> angles;
+        std::array<float, 3> mins;
+        std::array<float, 3> maxs;
+    };
+
+    /**
+     * @brief Player history interface
+     *
+     * Keeps recent positions of every player, recorded after StartFrame, so plugins validating hits
+     * or movement can look up where players were in the past without polling edicts themselves.
+     * Positions between two records are interpolated. History of the player is cleared when the player leaves the slot.
+     */
+    class IPlayerHistory
+    {
+    public:
+        /**
+         * @brief Player history API major version
+         */
+        static constexpr MajorInterfaceVersion MAJOR_VERSION = MajorInterfaceVersion(1);
+
+        /**
+         * @brief Player history API minor version
+         */
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+
+        /**
+         * @brief Player history API version
+         *
+         * Major version is present in the 16 most significant bits.
+         * Minor version is present in the 16 least significant bits.
+         */
+        static constexpr InterfaceVersion VERSION = InterfaceVersion(MAJOR_VERSION << 16 | MINOR_VERSION);
+
+        /**
+         * @brief Number of records kept for every player
+         */
+        static constexpr std::size_t RECORDS_NUM = 128;
+
+        /**
+         * @brief Minimal time in seconds between two records
+         *
+         * Keeps about a second of history regardless of the server's frame rate.
+         */
+        static constexpr float RECORD_INTERVAL = 0.01f;
+
+    public:
+        virtual ~IPlayerHistory() = default;
+
+        /**
+         * @brief Retrieves position of the player at the given time.
+         *
+         * Time later than the latest record returns the latest record.
+         *
+         * @param player    Player's edict.
+         * @param time      Server time.
+         *
+         * @return Interpolated position or std::nullopt if the time is older than the history of the player.
+         */
+        [[nodiscard]] virtual std::optional<PlayerSnapshot> getSnapshot(nstd::observer_ptr<Engine::IEdict> player,
+                                                                        float time) const = 0;
+
+        /**
+         * @brief Retrieves positions of all players at the given time.
+         *
+         * Players without history at the given time are skipped.
+         *
+         * @param time      Server time.
+         * @param snapshots Buffer to fill, it should have room for getMaxClients() snapshots.
+         * @param num       Size of the buffer.
+         *
+         * @return Number of filled snapshots.
+         */
+        virtual std::size_t rewind(float time, PlayerSnapshot *snapshots, std::size_t num) const = 0;
+    };
+} // namespace Anubis
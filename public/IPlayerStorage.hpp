@@ -0,0 +1,211 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+#include "observer_ptr.hpp"
+
+#include <cstddef>
+#include <new>
+
+namespace Anubis
+{
+    /**
+     * @brief Per-player storage interface
+     *
+     * Storage is organized in columns. Every column is a contiguous, cache-line-aligned array
+     * with one element per client slot and is indexed by the index of the player's edict (1..getMaxClientsLimit()).
+     * Element of the slot is reset to its default state when the client disconnects or gets dropped.
+     *
+     * @note Use PlayerColumn instead of calling this interface directly.
+     */
+    class IPlayerStorage
+    {
+    public:
+        /**
+         * @brief Player storage API major version
+         */
+        static constexpr MajorInterfaceVersion MAJOR_VERSION = MajorInterfaceVersion(1);
+
+        /**
+         * @brief Player storage API minor version
+         */
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+
+        /**
+         * @brief Player storage API version
+         *
+         * Major version is present in the 16 most significant bits.
+         * Minor version is present in the 16 least significant bits.
+         */
+        static constexpr InterfaceVersion VERSION = InterfaceVersion(MAJOR_VERSION << 16 | MINOR_VERSION);
+
+        /**
+         * @brief Function constructing an element in place.
+         */
+        using ElementCtor = void (*)(void *element);
+
+        /**
+         * @brief Function destroying an element in place.
+         */
+        using ElementDtor = void (*)(void *element);
+
+    public:
+        virtual ~IPlayerStorage() = default;
+
+        /**
+         * @brief Allocates a new column.
+         *
+         * Every element of the column is constructed before the function returns.
+         *
+         * @param size          Size of the element.
+         * @param alignment     Alignment of the element.
+         * @param ctor          Element constructor.
+         * @param dtor          Element destructor.
+         *
+         * @return Pointer to the first element of the column (slot 0).
+         */
+        virtual void *allocColumn(std::size_t size, std::size_t alignment, ElementCtor ctor, ElementDtor dtor) = 0;
+
+        /**
+         * @brief Frees a column.
+         *
+         * Every element of the column is destroyed.
+         *
+         * @param column        Pointer returned by allocColumn().
+         */
+        virtual void freeColumn(void *column) = 0;
+
+        /**
+         * @brief Retrieves number of elements in every column.
+         *
+         * @return Number of elements (slot 0 included).
+         */
+        [[nodiscard]] virtual std::uint32_t getSlotsNum() const = 0;
+    };
+
+    /**
+     * @brief Typed column of the per-player storage
+     *
+     * @b Examples
+     *
+     * @code{cpp}
+     * struct PlayerData
+     * {
+     *     std::uint32_t kills = 0;
+     *     float lastSeen = 0.0f;
+     * };
+     *
+     * PlayerColumn<PlayerData> gPlayerData;
+     *
+     * // in Init()
+     * gPlayerData = PlayerColumn<PlayerData>(api->getPlayerStorage(IPlayerStorage::VERSION));
+     *
+     * // anywhere else
+     * gPlayerData[edict->getIndex()].kills++;
+     * @endcode
+     *
+     * @tparam T Type of the element. Must be default constructible.
+     */
+    template<typename T>
+    class PlayerColumn
+    {
+    public:
+        PlayerColumn() = default;
+
+        explicit PlayerColumn(nstd::observer_ptr<IPlayerStorage> storage)
+            : m_storage(storage),
+              m_data(static_cast<T *>(storage->allocColumn(sizeof(T), alignof(T), &_construct, &_destroy)))
+        {
+        }
+
+        PlayerColumn(const PlayerColumn &other) = delete;
+        PlayerColumn &operator=(const PlayerColumn &other) = delete;
+
+        PlayerColumn(PlayerColumn &&other) noexcept : m_storage(other.m_storage), m_data(other.m_data)
+        {
+            other.m_storage = nullptr;
+            other.m_data = nullptr;
+        }
+
+        PlayerColumn &operator=(PlayerColumn &&other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_storage = other.m_storage;
+                m_data = other.m_data;
+                other.m_storage = nullptr;
+                other.m_data = nullptr;
+            }
+            return *this;
+        }
+
+        ~PlayerColumn()
+        {
+            release();
+        }
+
+        /**
+         * @brief Frees the column.
+         *
+         * @note Should be called from plugin's Shutdown().
+         */
+        void release()
+        {
+            if (m_storage && m_data)
+            {
+                m_storage->freeColumn(m_data);
+            }
+            m_storage = nullptr;
+            m_data = nullptr;
+        }
+
+        T &operator[](std::uint32_t index)
+        {
+            return m_data[index];
+        }
+
+        const T &operator[](std::uint32_t index) const
+        {
+            return m_data[index];
+        }
+
+        explicit operator bool() const
+        {
+            return m_data != nullptr;
+        }
+
+    private:
+        static void _construct(void *element)
+        {
+            new (element) T();
+        }
+
+        static void _destroy(void *element)
+        {
+            static_cast<T *>(element)->~T();
+        }
+
+    private:
+        nstd::observer_ptr<IPlayerStorage> m_storage;
+        T *m_data = nullptr;
+    };
+} // namespace Anubis
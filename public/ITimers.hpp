@@ -0,0 +1,137 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <functional>
+
+namespace Anubis
+{
+    /**
+     * @brief Timer handle
+     *
+     * Contains slot of the timer in the 16 least significant bits and its generation
+     * in the 16 most significant bits. Handle of the timer which already fired or was cancelled
+     * never becomes valid again.
+     */
+    ANUBIS_STRONG_TYPEDEF(std::uint32_t, TimerId)
+
+    /**
+     * @brief Invalid timer handle
+     */
+    static constexpr TimerId INVALID_TIMER = TimerId(0);
+
+    /**
+     * @brief Timer flags
+     */
+    enum class TimerFlags : std::uint8_t
+    {
+        None = 0,            /**< One shot timer, survives map change */
+        Repeat = (1 << 0),   /**< Timer is rescheduled with the same delay after it fires */
+        MapScoped = (1 << 1) /**< Timer is cancelled when the current map ends */
+    };
+
+    /**
+     * @brief Timer callback
+     *
+     * Called with the handle of the timer which has fired.
+     */
+    using TimerCallback = std::function<void(TimerId id)>;
+
+    /**
+     * @brief Timers interface
+     *
+     * Shared timers facility backed by a hierarchical timing wheel.
+     * Timers are advanced once per server frame so their resolution is bound by the server frame rate.
+     */
+    class ITimers
+    {
+    public:
+        /**
+         * @brief Timers API major version
+         */
+        static constexpr MajorInterfaceVersion MAJOR_VERSION = MajorInterfaceVersion(1);
+
+        /**
+         * @brief Timers API minor version
+         */
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+
+        /**
+         * @brief Timers API version
+         *
+         * Major version is present in the 16 most significant bits.
+         * Minor version is present in the 16 least significant bits.
+         */
+        static constexpr InterfaceVersion VERSION = InterfaceVersion(MAJOR_VERSION << 16 | MINOR_VERSION);
+
+    public:
+        virtual ~ITimers() = default;
+
+        /**
+         * @brief Schedules a timer.
+         *
+         * @param delay         Delay in seconds after which the callback is called.
+         *                      If timer is repeating then it is also an interval between the calls.
+         * @param callback      Function to call.
+         * @param flags         Timer flags.
+         *
+         * @return Handle of the timer.
+         */
+        virtual TimerId schedule(float delay, TimerCallback callback, TimerFlags flags = TimerFlags::None) = 0;
+
+        /**
+         * @brief Cancels a timer.
+         *
+         * @note It is safe to cancel the timer from inside its own callback.
+         *
+         * @param id            Handle of the timer.
+         *
+         * @return True if timer was pending, false otherwise.
+         */
+        virtual bool cancel(TimerId id) = 0;
+
+        /**
+         * @brief Checks if timer is still pending.
+         *
+         * @param id            Handle of the timer.
+         *
+         * @return True if timer is pending, false otherwise.
+         */
+        [[nodiscard]] virtual bool isPending(TimerId id) const = 0;
+
+        /**
+         * @brief Retrieves time left before the timer fires.
+         *
+         * @param id            Handle of the timer.
+         *
+         * @return Time left in seconds or 0 if timer is not pending.
+         */
+        [[nodiscard]] virtual float getTimeLeft(TimerId id) const = 0;
+
+        /**
+         * @brief Retrieves number of pending timers.
+         *
+         * @return Number of pending timers.
+         */
+        [[nodiscard]] virtual std::size_t getCount() const = 0;
+    };
+} // namespace Anubis
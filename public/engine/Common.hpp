@@ -22,6 +22,9 @@
 #include "../Common.hpp"
 #include <functional>
 
+struct entity_state_s;
+struct usercmd_s;
+
 namespace Anubis::Engine
 {
     enum class MsgDest : std::uint8_t
@@ -123,6 +126,17 @@ namespace Anubis::Engine
         Head
     };
 
+    /**
+     * @brief Set of leafs reachable from the player's view
+     *
+     * @note Available since 2.1
+     */
+    enum class PotentialSet : std::uint8_t
+    {
+        PVS = 0, /**< Potentially visible set */
+        PAS      /**< Potentially audible set */
+    };
+
     /**
      * Server command callback.
      */
@@ -134,6 +148,9 @@ namespace Anubis::Engine
     ANUBIS_STRONG_TYPEDEF(std::uint16_t, PrecacheId)
     ANUBIS_STRONG_TYPEDEF(std::uint8_t, MsgType)
     ANUBIS_STRONG_TYPEDEF_PTR(char, InfoBuffer)
+    ANUBIS_STRONG_TYPEDEF_PTR(::entity_state_s, EntityState)
+    ANUBIS_STRONG_TYPEDEF_PTR(unsigned char, VisibilitySet)
+    ANUBIS_STRONG_TYPEDEF_PTR(::usercmd_s, UserCmd)
     ANUBIS_STRONG_TYPEDEF(std::int32_t, UserID)
     ANUBIS_STRONG_TYPEDEF(std::int16_t, MsgSize)
     ANUBIS_STRONG_TYPEDEF(std::uint32_t, StringOffset)
@@ -142,6 +159,19 @@ namespace Anubis::Engine
     ANUBIS_STRONG_TYPEDEF(float, SndAttenuation)
     ANUBIS_STRONG_TYPEDEF(float, SndVolume)
 
+    /**
+     * Generational handle of the edict.
+     *
+     * Index of the edict is stored in the 12 least significant bits, generation of the slot in the remaining ones.
+     * Generation of the slot changes every time the edict is freed, so the handle never refers to a reused slot.
+     */
+    ANUBIS_STRONG_TYPEDEF(std::uint32_t, EdictHandle)
+
+    constexpr std::uint32_t EDICT_HANDLE_INDEX_BITS = 12;
+    constexpr std::uint32_t EDICT_HANDLE_INDEX_MASK = (1 << EDICT_HANDLE_INDEX_BITS) - 1;
+    constexpr std::uint32_t EDICTS_LIMIT = 1 << EDICT_HANDLE_INDEX_BITS;
+    constexpr EdictHandle INVALID_EDICT_HANDLE = EdictHandle(0);
+
     constexpr inline SndAttenuation toSndAttenution(float attenution)
     {
         return SndAttenuation {attenution};
@@ -0,0 +1,176 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../observer_ptr.hpp"
+#include "Common.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+#if defined _MSC_VER
+    #include <intrin.h>
+#endif
+
+namespace Anubis::Engine
+{
+    class IEdict;
+
+    /**
+     * @brief Range of edicts which are in use.
+     *
+     * Walks the occupancy bitset maintained by the engine library,
+     * so only the edicts which are in use are visited.
+     *
+     * @b Examples
+     *
+     * @code{cpp}
+     * for (nstd::observer_ptr<IEdict> edict : engine->getEdictsInUse())
+     * {
+     *     // ...
+     * }
+     * @endcode
+     *
+     * @note Range must not outlive the current frame.
+     * @note Edict freed while iterating can still be visited if it belongs to the currently walked block of 32 slots.
+     */
+    class EdictsRange
+    {
+    public:
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = nstd::observer_ptr<IEdict>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const value_type *;
+            using reference = value_type;
+
+        public:
+            Iterator(const std::uint32_t *words,
+                     std::uint32_t wordsNum,
+                     const std::unique_ptr<IEdict> *edicts,
+                     std::uint32_t wordIndex)
+                : m_words(words),
+                  m_wordsNum(wordsNum),
+                  m_edicts(edicts),
+                  m_wordIndex(wordIndex),
+                  m_word(wordIndex < wordsNum ? words[wordIndex] : 0)
+            {
+                _findNext();
+            }
+
+            [[nodiscard]] std::uint32_t getIndex() const
+            {
+                return m_index;
+            }
+
+            reference operator*() const
+            {
+                return m_edicts[m_index];
+            }
+
+            Iterator &operator++()
+            {
+                // clear the lowest set bit
+                m_word &= m_word - 1;
+                _findNext();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator &other) const
+            {
+                return m_index == other.m_index;
+            }
+
+            bool operator!=(const Iterator &other) const
+            {
+                return m_index != other.m_index;
+            }
+
+        private:
+            static std::uint32_t _countTrailingZeros(std::uint32_t word)
+            {
+#if defined _MSC_VER
+                unsigned long index;
+                _BitScanForward(&index, word);
+                return static_cast<std::uint32_t>(index);
+#else
+                return static_cast<std::uint32_t>(__builtin_ctz(word));
+#endif
+            }
+
+            void _findNext()
+            {
+                while (!m_word)
+                {
+                    if (++m_wordIndex >= m_wordsNum)
+                    {
+                        m_wordIndex = m_wordsNum;
+                        m_index = m_wordsNum * 32;
+                        return;
+                    }
+                    m_word = m_words[m_wordIndex];
+                }
+
+                m_index = m_wordIndex * 32 + _countTrailingZeros(m_word);
+            }
+
+        private:
+            const std::uint32_t *m_words;
+            std::uint32_t m_wordsNum;
+            const std::unique_ptr<IEdict> *m_edicts;
+            std::uint32_t m_wordIndex;
+            std::uint32_t m_word;
+            std::uint32_t m_index = 0;
+        };
+
+    public:
+        EdictsRange(const std::uint32_t *words, std::uint32_t wordsNum, const std::unique_ptr<IEdict> *edicts)
+            : m_words(words),
+              m_wordsNum(wordsNum),
+              m_edicts(edicts)
+        {
+        }
+
+        [[nodiscard]] Iterator begin() const
+        {
+            return {m_words, m_wordsNum, m_edicts, 0};
+        }
+
+        [[nodiscard]] Iterator end() const
+        {
+            return {m_words, m_wordsNum, m_edicts, m_wordsNum};
+        }
+
+    private:
+        const std::uint32_t *m_words;
+        std::uint32_t m_wordsNum;
+        const std::unique_ptr<IEdict> *m_edicts;
+    };
+} // namespace Anubis::Engine
@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <string_view>
+
+namespace Anubis::Engine
+{
+    /**
+     * @brief Cached identity of the client.
+     *
+     * Filled when the client connects and enters the game, refreshed when the client changes its userinfo
+     * and cleared on disconnect. Reading it does not go through any hook chain.
+     */
+    class IClientInfo
+    {
+    public:
+        virtual ~IClientInfo() = default;
+
+        /**
+         * @brief Checks if the cache holds data of the connected client.
+         *
+         * @return True if cache is filled, false otherwise.
+         */
+        [[nodiscard]] virtual bool isValid() const = 0;
+
+        /**
+         * @brief Retrieves auth ID of the client.
+         *
+         * @note Auth ID can still be pending until the client enters the game.
+         *
+         * @return Auth ID.
+         */
+        [[nodiscard]] virtual std::string_view getAuthID() const = 0;
+
+        /**
+         * @brief Retrieves user ID of the client.
+         *
+         * @return User ID.
+         */
+        [[nodiscard]] virtual UserID getUserID() const = 0;
+
+        /**
+         * @brief Retrieves value of the userinfo key.
+         *
+         * @param key       Userinfo key.
+         *
+         * @return Value of the key or empty string if key is not present.
+         */
+        [[nodiscard]] virtual std::string_view getInfoValue(std::string_view key) const = 0;
+    };
+} // namespace Anubis::Engine
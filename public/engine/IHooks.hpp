@@ -27,6 +27,7 @@
 #include <memory>
 #include <array>
 #include <optional>
+#include <vector>
 
 namespace Anubis::Game
 {
@@ -189,6 +190,13 @@ namespace Anubis::Engine
     using IEdAllocHook = IHook<nstd::observer_ptr<IEdict>>;
     using IEdAllocHookRegistry = IHookRegistry<nstd::observer_ptr<IEdict>>;
 
+    using IEdFreeHook = IHook<void, nstd::observer_ptr<IEdict>>;
+    using IEdFreeHookRegistry = IHookRegistry<void, nstd::observer_ptr<IEdict>>;
+
+    using IClientInfoChangedHook = IHook<void, nstd::observer_ptr<IEdict>, const std::vector<std::string_view> &>;
+    using IClientInfoChangedHookRegistry =
+        IHookRegistry<void, nstd::observer_ptr<IEdict>, const std::vector<std::string_view> &>;
+
     using IStringFromOffsetHook = IHook<std::string_view, StringOffset>;
     using IStringFromOffsetHookRegistry = IHookRegistry<std::string_view, StringOffset>;
 
@@ -412,5 +420,7 @@ namespace Anubis::Engine
         virtual nstd::observer_ptr<ISetOriginHookRegistry> setOrigin() = 0;
         virtual nstd::observer_ptr<ISetSizeHookRegistry> setSize() = 0;
         virtual nstd::observer_ptr<ICreateNamedEntityHookRegistry> createNamedEntity() = 0;
+        virtual nstd::observer_ptr<IEdFreeHookRegistry> edFree() = 0;
+        virtual nstd::observer_ptr<IClientInfoChangedHookRegistry> clientInfoChanged() = 0;
     };
 } // namespace Anubis::Engine
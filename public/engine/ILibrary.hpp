@@ -22,11 +22,16 @@
 #include "../observer_ptr.hpp"
 #include "Common.hpp"
 #include "IServerState.hpp"
+#include "EdictsRange.hpp"
+#include "IMsgBuilder.hpp"
+#include "TempEntity.hpp"
 
 #include <string_view>
 #include <cinttypes>
 #include <cstddef>
 #include <optional>
+#include <utility>
+#include <vector>
 
 typedef struct edict_s edict_t;
 typedef struct entvars_s entvars_t;
@@ -49,6 +54,7 @@ namespace Anubis::Engine
     class IHooks;
     class ICvar;
     class IGameClient;
+    class IClientInfo;
 
     class ILibrary
     {
@@ -62,7 +68,7 @@ namespace Anubis::Engine
         /**
          * @brief Engine API minor version
          */
-        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(1);
 
         /**
          * @brief Engine API version
@@ -269,5 +275,197 @@ namespace Anubis::Engine
         [[nodiscard]] virtual nstd::observer_ptr<globalvars_t> getGlobals() const = 0;
         virtual nstd::observer_ptr<ICvar> addToCache(cvar_t *cvar) = 0;
         virtual void removeHooks() = 0;
+
+        /* Entity handles */
+        [[nodiscard]] virtual EdictHandle getEdictHandle(nstd::observer_ptr<IEdict> edict) const = 0;
+        [[nodiscard]] virtual bool isValidHandle(EdictHandle handle) const = 0;
+
+        /**
+         * @brief Resolves the handle.
+         *
+         * @param handle    Handle of the edict.
+         *
+         * @return Edict or nullptr if the edict was freed since the handle was retrieved.
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<IEdict> getEdict(EdictHandle handle) const = 0;
+        virtual void invalidateEdict(const edict_t *edict) = 0;
+        virtual void invalidateEdicts() = 0;
+
+        /**
+         * @brief Retrieves edicts which are in use.
+         *
+         * Cheaper than walking through all edicts with getEdict() and checking IEdict::isFree().
+         *
+         * @return Range of edicts which are in use.
+         */
+        [[nodiscard]] virtual EdictsRange getEdictsInUse() const = 0;
+
+        /**
+         * @brief Retrieves cached identity of the client.
+         *
+         * Auth ID, user ID and userinfo are cached by Anubis, so reading them does not call into the engine.
+         * Changes of the userinfo are announced through IHooks::clientInfoChanged().
+         *
+         * @param player    Player's edict.
+         *
+         * @return Cached client info or nullptr if edict is not a player.
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<IClientInfo>
+            getClientInfo(nstd::observer_ptr<IEdict> player) const = 0;
+        virtual void updateClientInfo(nstd::observer_ptr<IEdict> player) = 0;
+        virtual void clearClientInfo(nstd::observer_ptr<IEdict> player) = 0;
+
+        /**
+         * @brief Disconnects the client from the server.
+         *
+         * @note Available since 2.1
+         *
+         * @param client    Client to disconnect.
+         * @param reason    Reason shown to the client.
+         */
+        virtual void dropClient(nstd::observer_ptr<IGameClient> client, std::string_view reason) = 0;
+
+        /**
+         * @brief Creates builder of the message.
+         *
+         * @note Available since 2.1
+         *
+         * @param msgType   Type of the message.
+         *
+         * @return Message builder.
+         */
+        [[nodiscard]] virtual std::unique_ptr<IMsgBuilder> createMsgBuilder(MsgType msgType) const = 0;
+
+        /**
+         * @brief Sends the built message to the clients.
+         *
+         * The message is copied straight to the buffer of each client, so it does not go through messageBegin()
+         * and other message hooks. Bots and clients which have not spawned yet are skipped.
+         * Unreliable message is skipped for the client if it does not fit into the client's datagram.
+         *
+         * @note Available since 2.1
+         *
+         * @param msg       Built message.
+         * @param clients   Clients to send the message to.
+         * @param reliable  True to send through the reliable channel, false to send in the unreliable datagram.
+         *
+         * @return Number of clients the message has been sent to.
+         */
+        virtual std::uint32_t multicastMsg(const IMsgBuilder &msg, ClientsMask clients, bool reliable) const = 0;
+
+        /**
+         * @brief Queues the built message for the clients.
+         *
+         * Queued messages are sent through the reliable channel at the start of the frame, as much as the client's
+         * rate and free space of its reliable buffer allow, so plugins do not overflow the channel of clients with
+         * low rates. Messages of higher priority are sent first. Message with non-zero channel replaces the queued
+         * message of the same type and channel. When the queue is full, the oldest messages of the lowest priority
+         * are dropped.
+         *
+         * @note Available since 2.1
+         *
+         * @param msg       Built message.
+         * @param clients   Clients to queue the message for.
+         * @param priority  Priority of the message.
+         * @param channel   Channel of the message or 0 if the message should not replace others.
+         *
+         * @return Number of clients the message has been queued for.
+         */
+        virtual std::uint32_t
+            queueMsg(const IMsgBuilder &msg, ClientsMask clients, MsgPriority priority, std::uint32_t channel) = 0;
+
+        /**
+         * @brief Retrieves statistics of the client's message queue.
+         *
+         * @note Available since 2.1
+         *
+         * @param client    Game client.
+         *
+         * @return Statistics of the queue.
+         */
+        [[nodiscard]] virtual MsgQueueStats getMsgQueueStats(nstd::observer_ptr<IGameClient> client) const = 0;
+
+        /**
+         * @brief Emits the temporary entity.
+         *
+         * Temporary entity is encoded once and sent at the start of the next frame. All temporary entities emitted
+         * during the frame are copied at once to the unreliable datagram of each client which should receive them.
+         * Clients are picked by the route from the origin of the temporary entity (start for beams and tracers).
+         * Bots and clients which have not spawned yet are skipped, so are temporary entities which do not fit
+         * into the client's datagram.
+         *
+         * @note Available since 2.1
+         *
+         * @param event     Temporary entity.
+         * @param route     Clients which receive the temporary entity.
+         * @param clients   Clients allowed to receive the temporary entity.
+         */
+        virtual void emitTempEntity(const TempEntityEvent &event,
+                                    TempEntityRoute route,
+                                    ClientsMask clients = ~ClientsMask(0)) = 0;
+
+        /**
+         * @brief Checks if the entity is in the potentially visible or audible set of the player.
+         *
+         * Sets of all players are taken once per frame on the first use, visibility of players to each other is checked
+         * once per frame on the first check. Visibility of other entities is cached for the rest of the frame once
+         * checked, so repeated checks cost a bit test. The set tells only if the entity can be seen or heard from
+         * the player's leafs, it does not trace the line of sight. Entities without a model are never in the set,
+         * the same as for the engine.
+         *
+         * @note Available since 2.1
+         *
+         * @param player    Player whose view is checked.
+         * @param entity    Entity to check.
+         * @param set       Set to check against.
+         *
+         * @return True if the entity is in the set, false otherwise or if the player is not in the game.
+         */
+        [[nodiscard]] virtual bool isInPotentialSet(nstd::observer_ptr<IEdict> player,
+                                                    nstd::observer_ptr<IEdict> entity,
+                                                    PotentialSet set) = 0;
+
+        /**
+         * @brief Retrieves players in the potentially visible or audible set of the player.
+         *
+         * @note Available since 2.1
+         *
+         * @param player    Player whose view is checked.
+         * @param set       Set to check against.
+         *
+         * @return Players in the set, bit n - 1 stands for the player of index n.
+         */
+        [[nodiscard]] virtual ClientsMask getPlayersInPotentialSet(nstd::observer_ptr<IEdict> player,
+                                                                   PotentialSet set) = 0;
+
+        /**
+         * @brief Retrieves the key value of the map entity.
+         *
+         * Key values are stored as the game receives them while the map is loading, so the original values of map
+         * entities are available without reading the BSP. Values are dropped when the entity is removed.
+         *
+         * @note Available since 2.1
+         * @note Returned value is valid until the map ends.
+         *
+         * @param entity    Map entity.
+         * @param key       Name of the key.
+         *
+         * @return Last value of the key or std::nullopt if the entity had no such key.
+         */
+        [[nodiscard]] virtual std::optional<std::string_view> getMapKeyValue(nstd::observer_ptr<IEdict> entity,
+                                                                             std::string_view key) const = 0;
+
+        /**
+         * @brief Retrieves all key values of the map entity in the order the game received them.
+         *
+         * @note Available since 2.1
+         * @note Returned values are valid until the map ends.
+         *
+         * @param entity    Map entity.
+         *
+         * @return Pairs of keys and values.
+         */
+        [[nodiscard]] virtual std::vector<std::pair<std::string_view, std::string_view>>
+            getMapKeyValues(nstd::observer_ptr<IEdict> entity) const = 0;
     };
 } // namespace Anubis::Engine
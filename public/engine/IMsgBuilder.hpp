@@ -0,0 +1,109 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Anubis::Engine
+{
+    /**
+     * @brief Set of clients
+     *
+     * Bit N represents the client in slot N, that is the player with edict index N + 1.
+     */
+    using ClientsMask = std::uint64_t;
+
+    /**
+     * @brief Priority of the queued message
+     */
+    enum class MsgPriority : std::uint8_t
+    {
+        Low = 0, /**< Dropped first when the queue is full */
+        Normal,
+        High /**< Sent first */
+    };
+
+    /**
+     * @brief Statistics of the client's message queue
+     */
+    struct MsgQueueStats
+    {
+        std::size_t queuedNum = 0;      /**< Messages waiting in the queue */
+        std::size_t queuedBytes = 0;    /**< Size of messages waiting in the queue */
+        std::uint64_t sentNum = 0;      /**< Messages sent from the queue */
+        std::uint64_t droppedNum = 0;   /**< Messages dropped because the queue was full */
+        std::uint64_t coalescedNum = 0; /**< Messages replaced by newer ones of the same type and channel */
+    };
+
+    /**
+     * @brief Message encoded once and sent to many clients
+     *
+     * Arguments are encoded the same way as the engine does it between messageBegin() and messageEnd().
+     * Built message can be sent any number of times through ILibrary::multicastMsg().
+     *
+     * @note Available since 2.1
+     */
+    class IMsgBuilder
+    {
+    public:
+        virtual ~IMsgBuilder() = default;
+
+        [[nodiscard]] virtual MsgType getType() const = 0;
+
+        /**
+         * @brief Checks if the message can be sent.
+         *
+         * @return False if too many bytes were written or size of the user message does not match the registered one.
+         */
+        [[nodiscard]] virtual bool isValid() const = 0;
+
+        /**
+         * @brief Retrieves the encoded message.
+         *
+         * @return Message type, length of the variable sized user message and the arguments.
+         */
+        [[nodiscard]] virtual const std::byte *getData() const = 0;
+
+        /**
+         * @brief Retrieves size of the encoded message.
+         *
+         * @return Size in bytes.
+         */
+        [[nodiscard]] virtual std::size_t getSize() const = 0;
+
+        /**
+         * @brief Removes all written arguments, so the builder can be reused for the next message of the same type.
+         */
+        virtual void clear() = 0;
+
+        virtual void writeByte(std::byte byteArg) = 0;
+        virtual void writeChar(char charArg) = 0;
+        virtual void writeShort(std::int16_t shortArg) = 0;
+        virtual void writeLong(std::int32_t longArg) = 0;
+        virtual void writeEntity(MsgEntity entArg) = 0;
+        virtual void writeAngle(MsgAngle angleArg) = 0;
+        virtual void writeCoord(MsgCoord coordArg) = 0;
+        virtual void writeString(std::string_view strArg) = 0;
+    };
+} // namespace Anubis::Engine
@@ -0,0 +1,174 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <array>
+#include <cstdint>
+#include <variant>
+
+namespace Anubis::Engine
+{
+    /**
+     * @brief Clients which receive the temporary entity
+     *
+     * @note Available since 2.1
+     */
+    enum class TempEntityRoute : std::uint8_t
+    {
+        All = 0, /**< Every client */
+        PVS,     /**< Clients which can see the origin of the temporary entity */
+        PAS      /**< Clients which can hear the origin of the temporary entity */
+    };
+
+    /**
+     * @brief Typed temporary entities
+     *
+     * Fields have the width of their encoding in svc_temp_entity, values out of range do not compile
+     * without an explicit cast. Scaled fields note their unit.
+     *
+     * @note Available since 2.1
+     */
+    namespace TempEntity
+    {
+        using Vector = std::array<float, 3>;
+
+        struct Color
+        {
+            std::uint8_t r;
+            std::uint8_t g;
+            std::uint8_t b;
+        };
+
+        /**
+         * @brief Beam between two points (TE_BEAMPOINTS)
+         */
+        struct BeamPoints
+        {
+            Vector start;
+            Vector end;
+            PrecacheId sprite;
+            std::uint8_t startFrame;
+            std::uint8_t frameRate; /**< In 0.1 frames per second */
+            std::uint8_t life;      /**< In 0.1 seconds */
+            std::uint8_t width;     /**< In 0.1 units */
+            std::uint8_t noise;     /**< In 0.01 units */
+            Color color;
+            std::uint8_t brightness;
+            std::uint8_t speed; /**< Scroll speed in 0.1 units */
+        };
+
+        /**
+         * @brief Animated sprite with light and sound (TE_EXPLOSION)
+         */
+        struct Explosion
+        {
+            Vector origin;
+            PrecacheId sprite;
+            std::uint8_t scale; /**< In 0.1 */
+            std::uint8_t frameRate;
+            std::uint8_t flags; /**< TE_EXPLFLAG_* */
+        };
+
+        /**
+         * @brief Rising alphablended sprite (TE_SMOKE)
+         */
+        struct Smoke
+        {
+            Vector origin;
+            PrecacheId sprite;
+            std::uint8_t scale; /**< In 0.1 */
+            std::uint8_t frameRate;
+        };
+
+        /**
+         * @brief Tracer effect (TE_TRACER)
+         */
+        struct Tracer
+        {
+            Vector start;
+            Vector end;
+        };
+
+        /**
+         * @brief Spark effect with ricochet sound (TE_SPARKS)
+         */
+        struct Sparks
+        {
+            Vector origin;
+        };
+
+        /**
+         * @brief Additive sprite played once (TE_SPRITE)
+         */
+        struct Sprite
+        {
+            Vector origin;
+            PrecacheId sprite;
+            std::uint8_t scale; /**< In 0.1 */
+            std::uint8_t brightness;
+        };
+
+        /**
+         * @brief Expanding cylinder of beams (TE_BEAMCYLINDER)
+         */
+        struct BeamCylinder
+        {
+            Vector center;
+            float radius;
+            PrecacheId sprite;
+            std::uint8_t startFrame;
+            std::uint8_t frameRate; /**< In 0.1 frames per second */
+            std::uint8_t life;      /**< In 0.1 seconds */
+            std::uint8_t width;     /**< In 0.1 units */
+            std::uint8_t noise;     /**< In 0.01 units */
+            Color color;
+            std::uint8_t brightness;
+            std::uint8_t speed; /**< Scroll speed in 0.1 units */
+        };
+
+        /**
+         * @brief Dynamic light (TE_DLIGHT)
+         */
+        struct DLight
+        {
+            Vector origin;
+            std::uint8_t radius; /**< In 10 units */
+            Color color;
+            std::uint8_t life;      /**< In 0.1 seconds */
+            std::uint8_t decayRate; /**< In 10 units per second */
+        };
+    } // namespace TempEntity
+
+    /**
+     * @brief Temporary entity of any supported type
+     *
+     * @note Available since 2.1
+     */
+    using TempEntityEvent = std::variant<TempEntity::BeamPoints,
+                                         TempEntity::Explosion,
+                                         TempEntity::Smoke,
+                                         TempEntity::Tracer,
+                                         TempEntity::Sparks,
+                                         TempEntity::Sprite,
+                                         TempEntity::BeamCylinder,
+                                         TempEntity::DLight>;
+} // namespace Anubis::Engine
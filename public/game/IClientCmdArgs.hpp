@@ -0,0 +1,146 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../Common.hpp"
+#include "../observer_ptr.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+namespace Anubis::Engine
+{
+    class IEdict;
+}
+
+namespace Anubis::Game
+{
+    /**
+     * @brief Computes case-insensitive hash of the client command name.
+     *
+     * Can be evaluated at compile time and compared with IClientCmdArgs::getNameHash().
+     *
+     * @param name      Command name.
+     *
+     * @return Hash of the name.
+     */
+    constexpr std::uint32_t hashClientCmdName(std::string_view name)
+    {
+        std::uint32_t hash = 2166136261u;
+        for (char c : name)
+        {
+            if (c >= 'A' && c <= 'Z')
+            {
+                c = static_cast<char>(c - 'A' + 'a');
+            }
+
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /**
+     * @brief Client command tokenized once per invocation.
+     *
+     * Arguments are copied when the command is tokenized, returned views stay valid for the lifetime of the object.
+     */
+    class IClientCmdArgs
+    {
+    public:
+        virtual ~IClientCmdArgs() = default;
+
+        /**
+         * @brief Returns number of arguments including the command name.
+         *
+         * @return Number of arguments.
+         */
+        [[nodiscard]] virtual std::uint8_t getArgc() const = 0;
+
+        /**
+         * @brief Returns the argument.
+         *
+         * @param arg       Index of the argument, 0 is the command name.
+         *
+         * @return Argument or empty string if index is out of range.
+         */
+        [[nodiscard]] virtual std::string_view getArgv(std::uint8_t arg) const = 0;
+
+        /**
+         * @brief Returns all arguments except the command name as a single string.
+         *
+         * @return Arguments.
+         */
+        [[nodiscard]] virtual std::string_view getArgs() const = 0;
+
+        /**
+         * @brief Returns case-insensitive hash of the command name.
+         *
+         * @return Hash of the command name.
+         */
+        [[nodiscard]] virtual std::uint32_t getNameHash() const = 0;
+
+        /**
+         * @brief Checks if the command name matches, ignoring case.
+         *
+         * @param name      Command name.
+         *
+         * @return True if names match, false otherwise.
+         */
+        [[nodiscard]] virtual bool isCmd(std::string_view name) const = 0;
+    };
+
+    /**
+     * @brief Handle of the registered client command
+     */
+    ANUBIS_STRONG_TYPEDEF(std::uint32_t, ClientCmdId)
+
+    /**
+     * @brief Invalid client command handle
+     */
+    static constexpr ClientCmdId INVALID_CLIENT_CMD = ClientCmdId(0);
+
+    /**
+     * @brief How the registered name is matched against the command name
+     */
+    enum class ClientCmdMatch : std::uint8_t
+    {
+        Exact = 0, /**< Command name must be equal to the registered name, ignoring case */
+        Prefix     /**< Command name must start with the registered name, ignoring case */
+    };
+
+    /**
+     * @brief Result of the client command handler
+     */
+    enum class ClientCmdResult : std::uint8_t
+    {
+        Continue = 0, /**< Let other handlers and the game process the command */
+        Handled,      /**< Let other handlers process the command but do not pass it to the game */
+        Supercede     /**< Stop processing the command */
+    };
+
+    /**
+     * @brief Client command handler
+     */
+    using ClientCmdCallback =
+        std::function<ClientCmdResult(nstd::observer_ptr<Engine::IEdict> player, const IClientCmdArgs &cmdArgs)>;
+} // namespace Anubis::Game
@@ -37,6 +37,8 @@ namespace Anubis::Game
         class IHooks;
     }
 
+    class IPlayerMove;
+
     using IGameInitHook = IHook<void>;
     using IGameInitHookRegistry = IHookRegistry<void>;
 
@@ -86,6 +88,42 @@ namespace Anubis::Game
     using IClientDisconnectHook = IHook<void, nstd::observer_ptr<Engine::IEdict>>;
     using IClientDisconnectHookRegistry = IHookRegistry<void, nstd::observer_ptr<Engine::IEdict>>;
 
+    using IAddToFullPackHook = IHook<bool,
+                                     Engine::EntityState,
+                                     nstd::observer_ptr<Engine::IEdict>,
+                                     nstd::observer_ptr<Engine::IEdict>,
+                                     std::uint32_t,
+                                     bool,
+                                     Engine::VisibilitySet>;
+    using IAddToFullPackHookRegistry = IHookRegistry<bool,
+                                                     Engine::EntityState,
+                                                     nstd::observer_ptr<Engine::IEdict>,
+                                                     nstd::observer_ptr<Engine::IEdict>,
+                                                     std::uint32_t,
+                                                     bool,
+                                                     Engine::VisibilitySet>;
+
+    using ICmdStartHook = IHook<void, nstd::observer_ptr<Engine::IEdict>, Engine::UserCmd, std::uint32_t>;
+    using ICmdStartHookRegistry =
+        IHookRegistry<void, nstd::observer_ptr<Engine::IEdict>, Engine::UserCmd, std::uint32_t>;
+
+    using ICmdEndHook = IHook<void, nstd::observer_ptr<Engine::IEdict>>;
+    using ICmdEndHookRegistry = IHookRegistry<void, nstd::observer_ptr<Engine::IEdict>>;
+
+    using IPlayerPreThinkHook = IHook<void, nstd::observer_ptr<Engine::IEdict>>;
+    using IPlayerPreThinkHookRegistry = IHookRegistry<void, nstd::observer_ptr<Engine::IEdict>>;
+
+    using IPlayerPostThinkHook = IHook<void, nstd::observer_ptr<Engine::IEdict>>;
+    using IPlayerPostThinkHookRegistry = IHookRegistry<void, nstd::observer_ptr<Engine::IEdict>>;
+
+    using IPMMoveHook = IHook<void, nstd::observer_ptr<IPlayerMove>, bool>;
+    using IPMMoveHookRegistry = IHookRegistry<void, nstd::observer_ptr<IPlayerMove>, bool>;
+
+    using IKeyValueHook =
+        IHook<bool, nstd::observer_ptr<Engine::IEdict>, std::string_view, std::string_view, std::string_view>;
+    using IKeyValueHookRegistry =
+        IHookRegistry<bool, nstd::observer_ptr<Engine::IEdict>, std::string_view, std::string_view, std::string_view>;
+
     class IHooks
     {
     public:
@@ -106,5 +144,66 @@ namespace Anubis::Game
         virtual nstd::observer_ptr<ICvarValueHookRegistry> cvarValue() = 0;
         virtual nstd::observer_ptr<ICvarValue2HookRegistry> cvarValue2() = 0;
         virtual nstd::observer_ptr<IClientDisconnectHookRegistry> clientDisconnect() = 0;
+
+        /**
+         * @brief AddToFullPack hook chain.
+         *
+         * Called only for entities marked with ITransmitFilter::setHooked().
+         *
+         * @note Available since 2.1
+         */
+        virtual nstd::observer_ptr<IAddToFullPackHookRegistry> addToFullPack() = 0;
+
+        /**
+         * @brief CmdStart hook chain.
+         *
+         * Called before the user command is run. The command is already recorded,
+         * see ILibrary::getUserCmds().
+         *
+         * @note Available since 2.1
+         */
+        virtual nstd::observer_ptr<ICmdStartHookRegistry> cmdStart() = 0;
+
+        /**
+         * @brief CmdEnd hook chain.
+         *
+         * @note Available since 2.1
+         */
+        virtual nstd::observer_ptr<ICmdEndHookRegistry> cmdEnd() = 0;
+
+        /**
+         * @brief PlayerPreThink hook chain.
+         *
+         * @note Available since 2.1
+         */
+        virtual nstd::observer_ptr<IPlayerPreThinkHookRegistry> playerPreThink() = 0;
+
+        /**
+         * @brief PlayerPostThink hook chain.
+         *
+         * @note Available since 2.1
+         */
+        virtual nstd::observer_ptr<IPlayerPostThinkHookRegistry> playerPostThink() = 0;
+
+        /**
+         * @brief PM_Move hook chain.
+         *
+         * Called for every user command of every player, the game is called directly when there are no hooks.
+         *
+         * @note Available since 2.1
+         */
+        virtual nstd::observer_ptr<IPMMoveHookRegistry> pmMove() = 0;
+
+        /**
+         * @brief KeyValue hook chain.
+         *
+         * Called for every key value of map entities while the map is loading and for key values dispatched
+         * to entities later. Key values of map entities are already stored, see Engine::ILibrary::getMapKeyValue().
+         * Hooks return true if the key value has been handled. Class name is an empty view with null data() if
+         * the engine has not passed any.
+         *
+         * @note Available since 2.1
+         */
+        virtual nstd::observer_ptr<IKeyValueHookRegistry> keyValue() = 0;
     };
 } // namespace Anubis::Game
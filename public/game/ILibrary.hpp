@@ -21,6 +21,10 @@
 
 #include "../observer_ptr.hpp"
 #include "../Common.hpp"
+#include "IClientCmdArgs.hpp"
+#include "ITransmitFilter.hpp"
+#include "UserCmdRecord.hpp"
+#include "IPlayerMove.hpp"
 
 #include <string_view>
 #include <filesystem>
@@ -67,7 +71,7 @@ namespace Anubis::Game
         /**
          * @brief Game API minor version
          */
-        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(0);
+        static constexpr MinorInterfaceVersion MINOR_VERSION = MinorInterfaceVersion(1);
 
         /**
          * @brief Game API version
@@ -151,5 +155,158 @@ namespace Anubis::Game
         [[nodiscard]] virtual void *getSystemHandle() const = 0;
         virtual void initVFuncHooks() = 0;
         virtual std::unique_ptr<IBaseEntity> getBaseEntity(edict_t *entity) const = 0;
+
+        /**
+         * @brief Returns client command being dispatched.
+         *
+         * The command is tokenized once, so reading it does not go through the engine for every argument.
+         *
+         * @note Available since 2.1
+         *
+         * @return Tokenized client command or nullptr if no client command is being dispatched.
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<IClientCmdArgs> getClientCmdArgs() const = 0;
+
+        /**
+         * @brief Registers handler of the client command.
+         *
+         * Commands are routed only to the handlers registered for their name. Commands without any handler
+         * go through the clientCmd hook chain, commands with handlers skip it.
+         *
+         * @note Available since 2.1
+         *
+         * @param name          Name of the command.
+         * @param callback      Function to call.
+         * @param match         How the name is matched.
+         *
+         * @return Handle of the registered command or INVALID_CLIENT_CMD on failure.
+         */
+        virtual ClientCmdId registerClientCmd(std::string_view name,
+                                              ClientCmdCallback callback,
+                                              ClientCmdMatch match = ClientCmdMatch::Exact) = 0;
+
+        /**
+         * @brief Unregisters handler of the client command.
+         *
+         * @note It is safe to unregister the handler from inside its own callback.
+         * @note Available since 2.1
+         *
+         * @param id            Handle of the registered command.
+         *
+         * @return True if handler was registered, false otherwise.
+         */
+        virtual bool unregisterClientCmd(ClientCmdId id) = 0;
+
+        /**
+         * @brief Retrieves the filter of entities sent to clients.
+         *
+         * @note Available since 2.1
+         *
+         * @return Transmit filter.
+         */
+        [[nodiscard]] virtual nstd::observer_ptr<ITransmitFilter> getTransmitFilter() const = 0;
+
+        /**
+         * @brief Adds the entity to the client's packet.
+         *
+         * @note Available since 2.1
+         *
+         * @param state     State of the entity to fill in.
+         * @param entity    Entity's edict.
+         * @param host      Client's edict.
+         * @param hostFlags Flags of the client.
+         * @param player    True if the entity is a player.
+         * @param set       PVS of the client or nullptr to skip the visibility check.
+         *
+         * @return True if the entity has been added, false otherwise.
+         */
+        virtual bool pfnAddToFullPack(Engine::EntityState state,
+                                      nstd::observer_ptr<Engine::IEdict> entity,
+                                      nstd::observer_ptr<Engine::IEdict> host,
+                                      std::uint32_t hostFlags,
+                                      bool player,
+                                      Engine::VisibilitySet set,
+                                      FuncCallType callType) = 0;
+
+        /**
+         * @brief Called before the user command of the player is run.
+         *
+         * @note Available since 2.1
+         *
+         * @param player        Player's edict.
+         * @param cmd           User command.
+         * @param randomSeed    Shared random seed of the command.
+         */
+        virtual void pfnCmdStart(nstd::observer_ptr<Engine::IEdict> player,
+                                 Engine::UserCmd cmd,
+                                 std::uint32_t randomSeed,
+                                 FuncCallType callType) = 0;
+
+        /**
+         * @brief Called after the user command of the player is run.
+         *
+         * @note Available since 2.1
+         */
+        virtual void pfnCmdEnd(nstd::observer_ptr<Engine::IEdict> player, FuncCallType callType) = 0;
+
+        /**
+         * @brief Called before the player's physics are run.
+         *
+         * @note Available since 2.1
+         */
+        virtual void pfnPlayerPreThink(nstd::observer_ptr<Engine::IEdict> player, FuncCallType callType) = 0;
+
+        /**
+         * @brief Called after the player's physics are run.
+         *
+         * @note Available since 2.1
+         */
+        virtual void pfnPlayerPostThink(nstd::observer_ptr<Engine::IEdict> player, FuncCallType callType) = 0;
+
+        /**
+         * @brief Copies the latest user commands received from the player.
+         *
+         * Up to USER_CMD_RECORDS_NUM commands are kept for every player, they are cleared when the player disconnects.
+         * Commands are copied oldest first, the last one is the most recent command.
+         *
+         * @note Available since 2.1
+         *
+         * @param player    Player's edict.
+         * @param records   Buffer to copy the commands into.
+         * @param num       Max number of commands to copy.
+         *
+         * @return Number of copied commands.
+         */
+        virtual std::size_t
+            getUserCmds(nstd::observer_ptr<Engine::IEdict> player, UserCmdRecord *records, std::size_t num) const = 0;
+
+        /**
+         * @brief Runs the player movement.
+         *
+         * @note Available since 2.1
+         *
+         * @param playerMove    View over the player movement state.
+         * @param server        True if the movement is run by the server.
+         */
+        virtual void pfnPMMove(nstd::observer_ptr<IPlayerMove> playerMove, bool server, FuncCallType callType) = 0;
+
+        /**
+         * @brief Passes the key value to the entity.
+         *
+         * @note Available since 2.1
+         *
+         * @param entity        Entity's edict.
+         * @param className     Class name of the entity. Empty view with null data() if the engine has not passed any,
+         *                      the game sets only entity variables then.
+         * @param key           Name of the key.
+         * @param value         Value of the key.
+         *
+         * @return True if the entity has handled the key value.
+         */
+        virtual bool pfnKeyValue(nstd::observer_ptr<Engine::IEdict> entity,
+                                 std::string_view className,
+                                 std::string_view key,
+                                 std::string_view value,
+                                 FuncCallType callType) = 0;
     };
 } // namespace Anubis::Game
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../observer_ptr.hpp"
+#include "../engine/Common.hpp"
+#include "../engine/IEdict.hpp"
+
+#include <array>
+#include <cstdint>
+
+struct playermove_s;
+
+namespace Anubis::Game
+{
+    /**
+     * @brief View over the game's player movement state
+     *
+     * Accessors read and write the game's playermove structure directly, nothing is copied.
+     *
+     * @note The view is valid only during the PM_Move hook chain it was passed to.
+     * @note Available since 2.1
+     */
+    class IPlayerMove
+    {
+    public:
+        virtual ~IPlayerMove() = default;
+
+        /**
+         * @brief Returns edict index of the moved player.
+         */
+        [[nodiscard]] virtual std::uint32_t getPlayerIndex() const = 0;
+
+        /**
+         * @brief Returns true if the movement is run by the server, false if it is run by the client.
+         */
+        [[nodiscard]] virtual bool isServer() const = 0;
+
+        [[nodiscard]] virtual float getFrameTime() const = 0;
+        [[nodiscard]] virtual std::array<float, 3> getOrigin() const = 0;
+        [[nodiscard]] virtual std::array<float, 3> getAngles() const = 0;
+        [[nodiscard]] virtual std::array<float, 3> getVelocity() const = 0;
+        [[nodiscard]] virtual std::array<float, 3> getBaseVelocity() const = 0;
+        [[nodiscard]] virtual float getMaxSpeed() const = 0;
+        [[nodiscard]] virtual float getClientMaxSpeed() const = 0;
+        [[nodiscard]] virtual float getGravity() const = 0;
+        [[nodiscard]] virtual float getFriction() const = 0;
+        [[nodiscard]] virtual Engine::IEdict::Flag getFlags() const = 0;
+        [[nodiscard]] virtual Engine::IEdict::MoveType getMoveType() const = 0;
+
+        /**
+         * @brief Returns index of the physent the player stands on or -1 if the player is in the air.
+         */
+        [[nodiscard]] virtual std::int32_t getOnGround() const = 0;
+        [[nodiscard]] virtual std::int32_t getWaterLevel() const = 0;
+        [[nodiscard]] virtual std::uint16_t getOldButtons() const = 0;
+
+        /**
+         * @brief Returns user command being run.
+         */
+        [[nodiscard]] virtual Engine::UserCmd getCmd() const = 0;
+
+        virtual void setOrigin(std::array<float, 3> origin) = 0;
+        virtual void setVelocity(std::array<float, 3> velocity) = 0;
+        virtual void setBaseVelocity(std::array<float, 3> baseVelocity) = 0;
+        virtual void setMaxSpeed(float maxSpeed) = 0;
+        virtual void setClientMaxSpeed(float clientMaxSpeed) = 0;
+        virtual void setGravity(float gravity) = 0;
+        virtual void setFriction(float friction) = 0;
+        virtual void setOldButtons(std::uint16_t oldButtons) = 0;
+
+        virtual explicit operator playermove_s *() const = 0;
+    };
+} // namespace Anubis::Game
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../observer_ptr.hpp"
+#include "../engine/Common.hpp"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace Anubis::Engine
+{
+    class IEdict;
+}
+
+namespace Anubis::Game
+{
+    /**
+     * @brief Overrides of the entity state sent to clients
+     *
+     * Fields which are set replace the values filled in by the game.
+     */
+    struct EntityStateOverride
+    {
+        std::optional<std::int32_t> renderMode;
+        std::optional<std::int32_t> renderAmt;
+        std::optional<std::array<std::uint8_t, 3>> renderColor;
+        std::optional<std::int32_t> renderFx;
+        std::optional<std::int32_t> solid;
+        std::int32_t effectsSet = 0;   /**< Effects flags to add */
+        std::int32_t effectsClear = 0; /**< Effects flags to remove */
+    };
+
+    /**
+     * @brief Transmit filter interface
+     *
+     * Decides which entities are sent to which clients from bitsets prepared ahead of time, so the game's
+     * AddToFullPack is not dispatched through the hook chain for every entity, client and frame.
+     * Only entities marked with setHooked() go through IHooks::addToFullPack().
+     *
+     * State of the entity is cleared when the entity is removed, state of the client when the client disconnects.
+     *
+     * @note Available since 2.1
+     */
+    class ITransmitFilter
+    {
+    public:
+        virtual ~ITransmitFilter() = default;
+
+        /**
+         * @brief Stops or resumes sending the entity to the client.
+         *
+         * @param host      Client's edict.
+         * @param entity    Entity's edict.
+         * @param never     True to never send the entity, false to let the game decide.
+         */
+        virtual void setNeverTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                      nstd::observer_ptr<Engine::IEdict> entity,
+                                      bool never) = 0;
+
+        /**
+         * @brief Sends the entity to the client regardless of the client's PVS.
+         *
+         * The game can still reject the entity, e.g. when it has no model.
+         *
+         * @param host      Client's edict.
+         * @param entity    Entity's edict.
+         * @param always    True to skip PVS check, false to let the game decide.
+         */
+        virtual void setAlwaysTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                       nstd::observer_ptr<Engine::IEdict> entity,
+                                       bool always) = 0;
+
+        [[nodiscard]] virtual bool isNeverTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                                   nstd::observer_ptr<Engine::IEdict> entity) const = 0;
+        [[nodiscard]] virtual bool isAlwaysTransmit(nstd::observer_ptr<Engine::IEdict> host,
+                                                    nstd::observer_ptr<Engine::IEdict> entity) const = 0;
+
+        /**
+         * @brief Dispatches the entity through IHooks::addToFullPack().
+         *
+         * @param entity    Entity's edict.
+         * @param hooked    True to call the hook chain for the entity, false to call the game directly.
+         */
+        virtual void setHooked(nstd::observer_ptr<Engine::IEdict> entity, bool hooked) = 0;
+        [[nodiscard]] virtual bool isHooked(nstd::observer_ptr<Engine::IEdict> entity) const = 0;
+
+        /**
+         * @brief Overrides the state of the entity sent to all clients.
+         *
+         * @param entity        Entity's edict.
+         * @param stateOverride Override or std::nullopt to remove it.
+         */
+        virtual void setStateOverride(nstd::observer_ptr<Engine::IEdict> entity,
+                                      std::optional<EntityStateOverride> stateOverride) = 0;
+    };
+} // namespace Anubis::Game
@@ -0,0 +1,50 @@
+/*
+ *  Copyright (C) 2020-2021 Anubis Development Team
+ *
+ *  This file is part of Anubis.
+ *
+ *  Anubis is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  Anubis is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with Anubis.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Anubis::Game
+{
+    /**
+     * @brief Number of user commands kept for every client
+     *
+     * @note Available since 2.1
+     */
+    constexpr std::size_t USER_CMD_RECORDS_NUM = 64;
+
+    /**
+     * @brief Compact copy of the user command received from the client
+     *
+     * @note Available since 2.1
+     */
+    struct UserCmdRecord
+    {
+        std::array<float, 3> viewAngles;
+        float forwardMove;
+        float sideMove;
+        float upMove;
+        std::uint16_t buttons;
+        std::uint8_t msec;
+        std::uint8_t impulse;
+    };
+} // namespace Anubis::Game